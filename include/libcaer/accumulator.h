@@ -0,0 +1,195 @@
+/**
+ * @file accumulator.h
+ *
+ * The event accumulator turns polarity events into dense 2D
+ * representations, for visualization or as input to neural networks.
+ * Polarity packets are added incrementally, and the representation
+ * can be read out at any time, either as a frame event or as a raw
+ * buffer of floats. Available are event counts, last timestamps,
+ * exponentially decaying time surfaces and voxel grids.
+ * Decay is lazy: it is only computed for pixels that get events,
+ * and for the whole image when reading it out, so adding events
+ * costs the same however long ago the last read-out was.
+ * Work can be split in horizontal tiles over multiple threads.
+ * Please note that the accumulator is not thread-safe, all function
+ * calls should happen on the same thread, unless you take care that
+ * they never overlap.
+ */
+
+#ifndef LIBCAER_ACCUMULATOR_H_
+#define LIBCAER_ACCUMULATOR_H_
+
+#include "events/frame.h"
+#include "events/polarity.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Pointer to event accumulator structure (private).
+ */
+typedef struct caer_accumulator *caerAccumulator;
+
+/**
+ * List of supported event accumulator representations.
+ */
+enum caer_accumulator_types {
+	/// Number of events per pixel. With CAER_ACCUMULATOR_POLARITY set,
+	/// ON events count +1 and OFF events -1. With CAER_ACCUMULATOR_DECAY
+	/// set, counts decay exponentially with that time constant.
+	ACCUMULATOR_EVENT_COUNT = 0,
+	/// Timestamp of the last event per pixel.
+	ACCUMULATOR_TIMESTAMP = 1,
+	/// Exponentially decaying time surface, exp(-(t - last) / decay),
+	/// 1 for an event at the read-out time, 0 for pixels without events.
+	ACCUMULATOR_TIME_SURFACE = 2,
+	/// Voxel grid: CAER_ACCUMULATOR_VOXEL_BINS temporal bins of
+	/// CAER_ACCUMULATOR_VOXEL_BIN_DURATION each, starting at the first
+	/// event after a reset. Each event adds its polarity (+1/-1) to
+	/// the two nearest bins, weighted by its distance in time to them.
+	ACCUMULATOR_VOXEL_GRID = 3,
+};
+
+/**
+ * Allocate memory and initialize the event accumulator.
+ * At initialization, it counts events, without polarity and decay,
+ * on one thread.
+ *
+ * @param sizeX maximum X axis resolution.
+ * @param sizeY maximum Y axis resolution.
+ *
+ * @return event accumulator instance, NULL on error.
+ */
+caerAccumulator caerAccumulatorInitialize(uint16_t sizeX, uint16_t sizeY);
+
+/**
+ * Destroy an event accumulator instance and free its memory.
+ *
+ * @param accumulator a valid event accumulator instance.
+ */
+void caerAccumulatorDestroy(caerAccumulator accumulator);
+
+/**
+ * Add the valid events of a polarity packet to the representation.
+ * Events must come in time order, across packets too.
+ *
+ * @param accumulator a valid event accumulator instance.
+ * @param polarity a valid polarity event packet. If NULL, no operation
+ *                 is performed.
+ */
+void caerAccumulatorAccumulate(caerAccumulator accumulator, caerPolarityEventPacketConst polarity);
+
+/**
+ * Clear the representation, as if no events had been added yet.
+ * Configuration is kept.
+ *
+ * @param accumulator a valid event accumulator instance.
+ */
+void caerAccumulatorReset(caerAccumulator accumulator);
+
+/**
+ * Read out the representation into a buffer of floats.
+ * The buffer holds (sizeX * sizeY) values, laid out row by row like the
+ * pixels of a frame, times CAER_ACCUMULATOR_VOXEL_BINS for voxel grids,
+ * one full image per bin. Values are event counts, time surface values
+ * and voxel grid sums as described for the types. For last timestamps,
+ * they are the time in microseconds since the last event, or -1 for
+ * pixels that had none. Decay is applied up to the given timestamp.
+ *
+ * @param accumulator a valid event accumulator instance.
+ * @param buffer array of floats to write the values into.
+ * @param timestamp 64bit read-out timestamp in microseconds, should not
+ *                  be before the last added event.
+ */
+void caerAccumulatorGetBuffer(caerAccumulator accumulator, float *buffer, int64_t timestamp);
+
+/**
+ * Read out the representation as a new grayscale frame event.
+ * Values are normalized to the full 16 bit range of the pixels:
+ * counts and voxel grids by their largest (absolute) value, with
+ * zero at the middle of the range if they can be negative; last
+ * timestamps from the oldest (dark) to the newest (bright) one;
+ * time surfaces directly. Voxel grid bins are stacked vertically.
+ * The frame's exposure goes from the first event after a reset
+ * to the read-out timestamp.
+ *
+ * @param accumulator a valid event accumulator instance.
+ * @param timestamp 64bit read-out timestamp in microseconds, should not
+ *                  be before the last added event.
+ * @param eventSource the unique ID representing the source/generator
+ *                    of the frame packet.
+ *
+ * @return a new frame event packet with one frame, NULL on error.
+ *         Remember to free() it once done!
+ */
+caerFrameEventPacket caerAccumulatorGenerateFrame(caerAccumulator accumulator, int64_t timestamp, int16_t eventSource);
+
+/**
+ * Set event accumulator configuration parameters.
+ * Changing the type or the number of voxel bins resets the representation.
+ *
+ * @param accumulator a valid event accumulator instance.
+ * @param paramAddr a configuration parameter address, see defines CAER_ACCUMULATOR_*.
+ * @param param a configuration parameter value integer.
+ *
+ * @return true if operation successful, false otherwise.
+ */
+bool caerAccumulatorConfigSet(caerAccumulator accumulator, uint8_t paramAddr, uint64_t param);
+
+/**
+ * Get event accumulator configuration parameters.
+ *
+ * @param accumulator a valid event accumulator instance.
+ * @param paramAddr a configuration parameter address, see defines CAER_ACCUMULATOR_*.
+ * @param param a pointer to a configuration parameter value integer,
+ *              in which to store the current value.
+ *
+ * @return true if operation successful, false otherwise.
+ */
+bool caerAccumulatorConfigGet(caerAccumulator accumulator, uint8_t paramAddr, uint64_t *param);
+
+/**
+ * Event Accumulator:
+ * representation to build, see 'enum caer_accumulator_types'.
+ */
+#define CAER_ACCUMULATOR_TYPE 0
+/**
+ * Event Accumulator:
+ * event counts take polarity into account, ON events add
+ * one and OFF events subtract one.
+ */
+#define CAER_ACCUMULATOR_POLARITY 1
+/**
+ * Event Accumulator:
+ * decay time constant in microseconds, for event counts
+ * (0 means no decay) and time surfaces (0 is treated as 1).
+ */
+#define CAER_ACCUMULATOR_DECAY 2
+/**
+ * Event Accumulator:
+ * number of temporal bins of voxel grids (1-16).
+ */
+#define CAER_ACCUMULATOR_VOXEL_BINS 3
+/**
+ * Event Accumulator:
+ * duration of each voxel grid bin, in microseconds.
+ * Events after the last bin are dropped.
+ */
+#define CAER_ACCUMULATOR_VOXEL_BIN_DURATION 4
+/**
+ * Event Accumulator:
+ * number of threads to split the image over, in horizontal tiles (1-16).
+ */
+#define CAER_ACCUMULATOR_THREADS 5
+/**
+ * Event Accumulator:
+ * number of events added since the last reset (read-only).
+ */
+#define CAER_ACCUMULATOR_STATISTICS 6
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBCAER_ACCUMULATOR_H_ */
@@ -806,6 +806,95 @@ enum caer_davis_aps_frame_modes {
  */
 #define DAVIS_CONFIG_APS_FRAME_MODE 102
 
+/**
+ * Parameter address for module DAVIS_CONFIG_APS:
+ * automatic exposure control, only use every Nth row and column
+ * of the frame to compute the exposure statistics. 1 (default)
+ * uses all pixels, higher values greatly reduce the processing
+ * cost at high frame rates.
+ */
+#define DAVIS_CONFIG_APS_AUTOEXPOSURE_SUBSAMPLE 103
+/**
+ * Parameter address for module DAVIS_CONFIG_APS:
+ * automatic exposure control, start column of the metering region,
+ * in sensor coordinates. Pixels inside the metering region are
+ * weighted by DAVIS_CONFIG_APS_AUTOEXPOSURE_ROI_WEIGHT.
+ */
+#define DAVIS_CONFIG_APS_AUTOEXPOSURE_ROI_START_COLUMN 104
+/**
+ * Parameter address for module DAVIS_CONFIG_APS:
+ * automatic exposure control, start row of the metering region,
+ * in sensor coordinates.
+ */
+#define DAVIS_CONFIG_APS_AUTOEXPOSURE_ROI_START_ROW 105
+/**
+ * Parameter address for module DAVIS_CONFIG_APS:
+ * automatic exposure control, end column of the metering region,
+ * in sensor coordinates (inclusive).
+ */
+#define DAVIS_CONFIG_APS_AUTOEXPOSURE_ROI_END_COLUMN 106
+/**
+ * Parameter address for module DAVIS_CONFIG_APS:
+ * automatic exposure control, end row of the metering region,
+ * in sensor coordinates (inclusive).
+ */
+#define DAVIS_CONFIG_APS_AUTOEXPOSURE_ROI_END_ROW 107
+/**
+ * Parameter address for module DAVIS_CONFIG_APS:
+ * automatic exposure control, how many times pixels inside the
+ * metering region count compared to pixels outside of it (0-255).
+ * 1 (default) weights all pixels equally, 0 only uses the pixels
+ * inside the metering region (spot metering).
+ */
+#define DAVIS_CONFIG_APS_AUTOEXPOSURE_ROI_WEIGHT 108
+
+/**
+ * List of supported automatic exposure control modes.
+ */
+enum caer_davis_aps_autoexposure_modes {
+	APS_AUTOEXPOSURE_HEURISTIC  = 0,
+	APS_AUTOEXPOSURE_PREDICTIVE = 1,
+};
+
+/**
+ * Parameter address for module DAVIS_CONFIG_APS:
+ * select the automatic exposure control algorithm. Available are:
+ * 0 - Heuristic (default), corrects the exposure by small steps,
+ *     based on under- and over-exposure and the mean sample value,
+ *     only acting on frames taken with the last set exposure.
+ * 1 - Predictive, estimates the scene brightness from the mean sample
+ *     value of any frame and its exposure, and jumps directly to the
+ *     exposure that gives the target mean sample value. Converges in
+ *     one or two frames after lighting changes.
+ */
+#define DAVIS_CONFIG_APS_AUTOEXPOSURE_MODE 109
+/**
+ * Parameter address for module DAVIS_CONFIG_APS:
+ * predictive automatic exposure control, target mean sample value
+ * in percent of the full pixel range (1-99, default 50).
+ */
+#define DAVIS_CONFIG_APS_AUTOEXPOSURE_TARGET_MSV 110
+/**
+ * Parameter address for module DAVIS_CONFIG_APS:
+ * predictive automatic exposure control, damping in percent (0-99).
+ * 0 (default) sets the predicted exposure immediately, higher values
+ * only move that part of the way there from the last set exposure,
+ * trading convergence speed for stability with flickering light.
+ */
+#define DAVIS_CONFIG_APS_AUTOEXPOSURE_DAMPING 111
+/**
+ * Parameter address for module DAVIS_CONFIG_APS:
+ * pixel format of the output frames, see 'enum caer_frame_event_pixel_format'.
+ * 0 - 16 bit (default), full precision, same as always.
+ * 1 - 8 bit, the 8 most significant bits of each pixel value,
+ *     halves frame memory and bandwidth.
+ * 2 - 10 bit packed, four pixel values in five bytes, keeps the
+ *     full precision of the APS ADC in 62.5% of the memory.
+ * Frame packets are sized for this, so it only takes effect on
+ * caerDeviceDataStart() calls!
+ */
+#define DAVIS_CONFIG_APS_FRAME_FORMAT 112
+
 /**
  * Parameter address for module DAVIS_CONFIG_IMU:
  * read-only parameter, contains information on the type of IMU
@@ -1126,6 +1215,64 @@ enum caer_davis_aps_frame_modes {
  */
 #define DAVIS_CONFIG_DDRAER_RUN 0
 
+/**
+ * Module address: host-side GPIO (DDR-AER) data reader configuration,
+ * for CAER_DEVICE_DAVIS_RPI only.
+ */
+#define CAER_HOST_CONFIG_GPIO -1
+
+/**
+ * Parameter address for module CAER_HOST_CONFIG_GPIO:
+ * CPUs the GPIO reader thread may run on, one bit per CPU.
+ * Zero means no restriction (default).
+ * Takes effect on the next caerDeviceDataStart().
+ */
+#define CAER_HOST_CONFIG_GPIO_CPU_AFFINITY 0
+/**
+ * Parameter address for module CAER_HOST_CONFIG_GPIO:
+ * real-time (SCHED_FIFO) priority of the GPIO reader thread, range [1,99].
+ * Zero means normal scheduling (default). Needs the CAP_SYS_NICE
+ * capability, else a warning is logged and normal scheduling is used.
+ * Takes effect on the next caerDeviceDataStart().
+ */
+#define CAER_HOST_CONFIG_GPIO_REALTIME_PRIORITY 1
+/**
+ * Parameter address for module CAER_HOST_CONFIG_GPIO:
+ * maximum number of DDR-AER transactions (two 16 bit words each)
+ * to read before processing them, range [1,4096] (default 4096).
+ */
+#define CAER_HOST_CONFIG_GPIO_BATCH_SIZE 2
+/**
+ * Parameter address for module CAER_HOST_CONFIG_GPIO:
+ * number of checks for a new request before processing the data
+ * read so far, if the device has nothing to send (default 100).
+ */
+#define CAER_HOST_CONFIG_GPIO_MAX_WAIT_REQ 3
+/**
+ * Parameter address for module CAER_HOST_CONFIG_GPIO:
+ * whether the device was opened in benchmark mode (read-only),
+ * see DAVIS_RPI_SERIAL_NUMBER_BENCHMARK.
+ */
+#define CAER_HOST_CONFIG_GPIO_BENCHMARK 4
+
+/**
+ * Serial number restriction for caerDeviceOpen() with CAER_DEVICE_DAVIS_RPI:
+ * open the device in GPIO benchmark mode. The CPLD must run the
+ * StreamTester logic (MachXO3_IoT) instead of the normal logic.
+ * On data start, all test patterns are transferred and checked, their
+ * bandwidth and error count is logged, and then the data shutdown
+ * notification is called. No events are generated.
+ */
+#define DAVIS_RPI_SERIAL_NUMBER_BENCHMARK "BENCHMARK"
+/**
+ * Serial number restriction for caerDeviceOpen() with CAER_DEVICE_DAVIS_RPI:
+ * open a simulated device instead of the Raspberry Pi hardware, in
+ * benchmark mode, see DAVIS_RPI_SERIAL_NUMBER_BENCHMARK. A thread emulates
+ * the StreamTester logic on simulated GPIO registers, so the GPIO reader's
+ * throughput can be measured on any Linux machine.
+ */
+#define DAVIS_RPI_SERIAL_NUMBER_MOCK "MOCK"
+
 //@{
 /**
  * Parameter address for module DAVIS128_CONFIG_BIAS:
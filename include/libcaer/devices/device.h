@@ -250,6 +250,23 @@ bool caerDeviceDataStop(caerDeviceHandle handle);
  */
 caerEventPacketContainer caerDeviceDataGet(caerDeviceHandle handle);
 
+/**
+ * Give an event packet container obtained from caerDeviceDataGet() back to the
+ * device once done with it, instead of freeing it with caerEventPacketContainerFree().
+ * Devices that support it (DAVIS) keep the contained frame event packets in a pool
+ * and reuse them for later frames, which avoids allocating and clearing large
+ * amounts of memory at high frame rates. All other packets and the container
+ * itself are freed. Unlike with caerFrameEventPacketAllocate(), the pixel memory
+ * past a frame's actual size is not guaranteed to be zero in reused packets.
+ * Must be called from the same thread as caerDeviceDataGet() and caerDeviceDataStop().
+ *
+ * @param handle a valid device handle.
+ * @param container an event packet container from caerDeviceDataGet(), which
+ *                  must not be used anymore after this call. If NULL, no
+ *                  operation is performed.
+ */
+void caerDeviceDataRecycle(caerDeviceHandle handle, caerEventPacketContainer container);
+
 #ifdef __cplusplus
 }
 #endif
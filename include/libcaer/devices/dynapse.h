@@ -116,6 +116,36 @@ extern "C" {
  */
 #define DYNAPSE_CONFIG_SPIKEGEN 16
 
+/**
+ * Module address: host-side spike packet configuration.
+ * Controls how spikes are grouped into event packets.
+ */
+#define CAER_HOST_CONFIG_SPIKE_PACKETS -5
+
+/**
+ * Parameter address for module CAER_HOST_CONFIG_SPIKE_PACKETS:
+ * split spikes into separate packets per chip or per core, instead of one
+ * packet with all spikes, see CAER_HOST_CONFIG_SPIKE_PACKETS_SPLIT_* values.
+ * Split packets sit in the packet container at position 1 (after the
+ * special packet) plus chip ID, or plus (chip ID * 4) + core ID; packets
+ * without spikes are NULL. This saves demultiplexing spikes downstream.
+ * Takes effect on the next caerDeviceDataStart().
+ */
+#define CAER_HOST_CONFIG_SPIKE_PACKETS_SPLIT 0
+
+/**
+ * One spike packet with all spikes (default).
+ */
+#define CAER_HOST_CONFIG_SPIKE_PACKETS_SPLIT_NONE 0
+/**
+ * One spike packet per chip (4 packets).
+ */
+#define CAER_HOST_CONFIG_SPIKE_PACKETS_SPLIT_CHIP 1
+/**
+ * One spike packet per core of each chip (16 packets).
+ */
+#define CAER_HOST_CONFIG_SPIKE_PACKETS_SPLIT_CORE 2
+
 /**
  * Set certain neurons of a core to use the TAU2 neuron leak bias.
  * By default neurons use the TAU1 neuron leak bias. You can also use
@@ -805,6 +835,32 @@ struct caer_bias_dynapse caerBiasDynapseParse(const uint32_t dynapseBias);
  */
 bool caerDynapseWriteSramWords(caerDeviceHandle handle, const uint16_t *data, uint32_t baseAddr, size_t numWords);
 
+/**
+ * Asynchronous version of caerDynapseWriteSramWords(): the words are sent
+ * in pipelined chunks, with several USB transfers in flight at once, and
+ * the function returns as soon as the upload has started. Only the setup
+ * of the SRAM controller, and the write of a trailing odd word, block
+ * before returning; a single word is written fully asynchronously.
+ * The callback is called exactly once, from the USB thread, when the upload
+ * has completed or failed. Neither close the device nor start another
+ * SRAM upload before that.
+ *
+ * @param handle a valid device handle.
+ * @param data array from which to read data to send to SRAM.
+ *             It is copied, and can be freed right after the call.
+ * @param baseAddr SRAM start address where to put the data.
+ * @param numWords number of 16bit words to transfer.
+ * @param uploadCallback function to call when the upload is done, with
+ *                       its success status. Can be NULL.
+ * @param uploadCallbackPtr pointer passed to the callback.
+ *
+ * @return true if the upload started, false otherwise. On false, the
+ *         callback is not called. With zero words, true is returned
+ *         and the callback is called right away.
+ */
+bool caerDynapseWriteSramWordsAsync(caerDeviceHandle handle, const uint16_t *data, uint32_t baseAddr, size_t numWords,
+	void (*uploadCallback)(void *uploadCallbackPtr, bool success), void *uploadCallbackPtr);
+
 /**
  * Specifies the poisson spike generator's spike rate.
  *
@@ -898,6 +954,77 @@ bool caerDynapseWriteCam(
  */
 bool caerDynapseSendDataToUSB(caerDeviceHandle handle, const uint32_t *data, size_t numConfig);
 
+/**
+ * Asynchronous version of caerDynapseSendDataToUSB(): the configuration is
+ * sent in pipelined chunks, with several USB transfers (and their
+ * verifications) in flight at once, and the function returns right away.
+ * This keeps the USB control pipe busy, for much faster network uploads.
+ * The callback is called exactly once, from the USB thread, when the upload
+ * has completed or failed. Chip selection is a separate configuration
+ * write, so wait for an upload to complete before selecting another chip!
+ *
+ * @param handle a valid device handle.
+ * @param data an array of integers holding configuration data.
+ *             It is copied, and can be freed right after the call.
+ * @param numConfig number of configuration parameters to send.
+ * @param uploadCallback function to call when the upload is done, with
+ *                       its success status. Can be NULL.
+ * @param uploadCallbackPtr pointer passed to the callback.
+ *
+ * @return true if the upload started, false otherwise. On false, the
+ *         callback is not called. With zero configuration parameters,
+ *         true is returned and the callback is called right away.
+ */
+bool caerDynapseSendDataToUSBAsync(caerDeviceHandle handle, const uint32_t *data, size_t numConfig,
+	void (*uploadCallback)(void *uploadCallbackPtr, bool success), void *uploadCallbackPtr);
+
+/**
+ * One synaptic connection of a network, from a neuron on a chip
+ * to a neuron on the same or another chip of the board.
+ */
+struct caer_dynapse_connection {
+	/// Chip of the source neuron, range [0,3] (DYNAPSE_CONFIG_DYNAPSE_U0 to U3).
+	uint8_t sourceChipId;
+	/// Chip global address of the source neuron, range [0,1023].
+	uint16_t sourceNeuronAddr;
+	/// Chip of the target neuron, range [0,3] (DYNAPSE_CONFIG_DYNAPSE_U0 to U3).
+	uint8_t targetChipId;
+	/// Chip global address of the target neuron, range [0,1023].
+	uint16_t targetNeuronAddr;
+	/// Synapse type, one of [DYNAPSE_CONFIG_CAMTYPE_F_EXC,DYNAPSE_CONFIG_CAMTYPE_S_EXC,
+	/// DYNAPSE_CONFIG_CAMTYPE_F_INH,DYNAPSE_CONFIG_CAMTYPE_S_INH].
+	uint8_t synapseType;
+};
+
+/**
+ * Program a whole network, given as a table of connections, into the
+ * CAMs and SRAMs of all chips. The table is the complete desired state:
+ * each connection takes one CAM of its target neuron (at most 64 inputs
+ * per neuron), and each source neuron gets one SRAM route per target
+ * chip, to all the cores it has targets in (at most 3 target chips per
+ * neuron, SRAM 0 is left alone for monitoring). Unused CAMs and SRAMs
+ * are cleared.
+ * A host-side copy of what was programmed is kept, so that calling this
+ * again with an edited table only writes the CAMs and SRAMs that changed.
+ * Any other write of chip content (caerDynapseWriteCam(), caerDynapseSendDataToUSB(),
+ * DYNAPSE_CONFIG_CHIP_CONTENT, ...) makes the next call program everything again.
+ * Uploads are pipelined as in caerDynapseSendDataToUSBAsync(), one chip
+ * at a time. Chips are selected as needed, so the selected chip is
+ * changed after this call.
+ * Please note that CAMs only match the 10 bit source neuron address,
+ * so same-address neurons of different chips routed to the same core
+ * can't be told apart: this is a limit of the hardware.
+ *
+ * @param handle a valid device handle.
+ * @param connections an array of connections. Can be NULL if numConnections is 0.
+ * @param numConnections number of connections, 0 clears the network.
+ *
+ * @return true on success, false otherwise (invalid or too dense
+ *         network, upload failure).
+ */
+bool caerDynapseWriteNetwork(
+	caerDeviceHandle handle, const struct caer_dynapse_connection *connections, size_t numConnections);
+
 /**
  * Generate bits to write a single CAM, to specify which spikes are allowed as input into a neuron.
  *
@@ -146,6 +146,22 @@ extern "C" {
 #define SAMSUNG_EVK_DVS_BIAS_SIMPLE_HIGH      3
 #define SAMSUNG_EVK_DVS_BIAS_SIMPLE_VERY_HIGH 4
 
+/**
+ * Module address: host-side polarity packet configuration.
+ * Controls how decoded polarity events are placed into event packets.
+ */
+#define CAER_HOST_CONFIG_POLARITY_PACKETS -5
+
+/**
+ * Parameter address for module CAER_HOST_CONFIG_POLARITY_PACKETS:
+ * sort the events of each column by Y address. With MGROUP compression
+ * enabled, pixel groups of a column can arrive out of order; sorting them
+ * gives downstream per-pixel processing better memory locality.
+ * Columns split across two packets are sorted within each packet.
+ * Disabled by default.
+ */
+#define CAER_HOST_CONFIG_POLARITY_PACKETS_SORT_COLUMNS 0
+
 /**
  * SAMSUNG_EVK device-related information.
  */
@@ -25,6 +25,19 @@ extern "C" {
  * read size for serial port communication.
  */
 #define CAER_HOST_CONFIG_SERIAL_READ_SIZE 0
+/**
+ * Parameter address for module CAER_HOST_CONFIG_SERIAL:
+ * minimum number of bytes to collect before processing them.
+ * Reading blocks until data arrives, and then for up to
+ * CAER_HOST_CONFIG_SERIAL_MAX_LATENCY to fill this batch.
+ */
+#define CAER_HOST_CONFIG_SERIAL_MIN_BATCH 1
+/**
+ * Parameter address for module CAER_HOST_CONFIG_SERIAL:
+ * maximum time to wait for the minimum batch to fill, in
+ * milliseconds. At zero, available data is processed right away.
+ */
+#define CAER_HOST_CONFIG_SERIAL_MAX_LATENCY 2
 
 /**
  * Parameter values for module CAER_HOST_CONFIG_SERIAL:
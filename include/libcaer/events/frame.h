@@ -31,6 +31,8 @@ extern "C" {
  * color filter arrangement to interpolate color images, see
  * the 'enum caer_frame_event_color_filter'.
  * Also, up to 128 different Regions of Interest (ROI) can be tracked.
+ * The storage format of the pixel values is given by the pixel format,
+ * see the 'enum caer_frame_event_pixel_format'.
  * Bit 0 is the valid mark, see 'common.h' for more details.
  */
 //@{
@@ -40,6 +42,8 @@ extern "C" {
 #define FRAME_COLOR_FILTER_MASK    0x0000000F
 #define FRAME_ROI_IDENTIFIER_SHIFT 8
 #define FRAME_ROI_IDENTIFIER_MASK  0x0000007F
+#define FRAME_PIXEL_FORMAT_SHIFT   15
+#define FRAME_PIXEL_FORMAT_MASK    0x00000003
 //@}
 
 /**
@@ -68,11 +72,33 @@ enum caer_frame_event_color_filter {
 	BWRG = 8, //!< Modified Bayer color filter, with white (pass all light) instead of extra green. Variation 4.
 };
 
+/**
+ * List of all frame event pixel format identifiers.
+ * Used to interpret the frame event pixel format field, which
+ * determines how pixel values are stored in the pixels array.
+ * The default is 16 bit values, which is what the pixels array
+ * is declared as. The other formats trade precision for memory
+ * and bandwidth: with PIXEL_FORMAT_10BIT_PACKED, each group of
+ * four consecutive values takes five bytes, the first four hold
+ * the 8 most significant bits of each value, the fifth their
+ * 2 least significant bits (first value in bits 0-1, second
+ * in bits 2-3 and so on). This loses nothing for sensors with
+ * a 10 bit ADC, like the DAVIS APS.
+ * The per-pixel get/set functions always work with values
+ * normalized to 16 bit depth, whatever the pixel format.
+ */
+enum caer_frame_event_pixel_format {
+	PIXEL_FORMAT_16BIT        = 0, //!< 16 bit little-endian unsigned integers, one per value.
+	PIXEL_FORMAT_8BIT         = 1, //!< 8 bit unsigned integers, one per value (8 most significant bits).
+	PIXEL_FORMAT_10BIT_PACKED = 2, //!< 10 bit values, packed four into five bytes (10 most significant bits).
+};
+
 /**
  * Frame event data structure definition.
  * This contains the actual information on the frame (ROI, color channels,
  * color filter), several timestamps to signal start and end of capture and
- * of exposure, as well as the actual pixels, in a 16 bit normalized format.
+ * of exposure, as well as the actual pixels, in a 16 bit normalized format
+ * by default, or in a more compact pixel format, see 'enum caer_frame_event_pixel_format'.
  * The (0, 0) address is in the upper left corner, like in OpenCV/computer graphics.
  * The pixel array is laid out row by row (increasing X axis), going from
  * top to bottom (increasing Y axis).
@@ -83,7 +109,7 @@ enum caer_frame_event_color_filter {
  * Please use caerGenericEventCopy() to copy frame events!
  */
 PACKED_STRUCT(struct caer_frame_event {
-	/// Event information (ROI region, color channels, color filter). First because of valid mark.
+	/// Event information (ROI region, color channels, color filter, pixel format). First because of valid mark.
 	uint32_t info;
 	/// Start of Frame (SOF) timestamp.
 	int32_t ts_startframe;
@@ -102,6 +128,7 @@ PACKED_STRUCT(struct caer_frame_event {
 	/// Y axis position (upper left offset) in pixels.
 	int32_t positionY;
 	/// Pixel array, 16 bit unsigned integers, normalized to 16 bit depth.
+	/// Holds bytes instead with the compact pixel formats.
 	/// The pixel array is laid out row by row (increasing X axis), going
 	/// from top to bottom (increasing Y axis). This prevents simple copy!
 	uint16_t pixels[1]; // size 1 here for C++ compatibility.
@@ -135,32 +162,59 @@ PACKED_STRUCT(struct caer_frame_event_packet {
 typedef struct caer_frame_event_packet *caerFrameEventPacket;
 typedef const struct caer_frame_event_packet *caerFrameEventPacketConst;
 
+/**
+ * Get the number of bytes needed to store the given number of
+ * pixel values in the given pixel format.
+ *
+ * @param pixelFormat the pixel format.
+ * @param valuesNumber the number of pixel values (pixels times channels).
+ *
+ * @return size in bytes.
+ */
+static inline size_t caerFrameEventPixelFormatBytes(
+	enum caer_frame_event_pixel_format pixelFormat, size_t valuesNumber) {
+	switch (pixelFormat) {
+		case PIXEL_FORMAT_8BIT:
+			return (valuesNumber);
+
+		case PIXEL_FORMAT_10BIT_PACKED:
+			return (((valuesNumber + 3) / 4) * 5);
+
+		case PIXEL_FORMAT_16BIT:
+		default:
+			return (valuesNumber * sizeof(uint16_t));
+	}
+}
+
 /**
  * Allocate a new frame events packet, passing the total number of maximum
- * pixels instead of the maximum X/Y dimensions expected.
+ * pixels and the pixel format the frames will be stored in.
  * Use free() to reclaim this memory.
- * The frame events allocate memory for a maximum sized pixels array, depending
- * on the parameters passed to this function, so that every event occupies the
- * same amount of memory (constant size). The actual frames inside of it
- * might be smaller than that, for example when using ROI, and their actual size
- * is stored inside the frame event and should always be queried from there.
- * The unused part of a pixels array is guaranteed to be zeros.
+ * Same as 'caerFrameEventPacketAllocateNumPixels()', except that the
+ * pixels array of each frame event is only as large as needed by the
+ * given pixel format. Frames in this packet must have their pixel format
+ * set with 'caerFrameEventSetPixelFormat()' before their lengths.
  *
  * @param eventCapacity the maximum number of events this packet will hold.
  * @param eventSource the unique ID representing the source/generator of this packet.
  * @param tsOverflow the current timestamp overflow counter value for this packet.
  * @param maxNumPixels the maximum number of pixels that can be held by a frame event.
  * @param maxChannelNumber the maximum expected number of channels for frames in this packet.
+ * @param pixelFormat the pixel format frames in this packet are stored in.
  *
  * @return a valid FrameEventPacket handle or NULL on error.
  */
-static inline caerFrameEventPacket caerFrameEventPacketAllocateNumPixels(
-	int32_t eventCapacity, int16_t eventSource, int32_t tsOverflow, int32_t maxNumPixels, int16_t maxChannelNumber) {
+static inline caerFrameEventPacket caerFrameEventPacketAllocatePixelFormat(int32_t eventCapacity,
+	int16_t eventSource, int32_t tsOverflow, int32_t maxNumPixels, int16_t maxChannelNumber,
+	enum caer_frame_event_pixel_format pixelFormat) {
 	if ((maxNumPixels <= 0) || (maxChannelNumber <= 0)) {
 		return (NULL);
 	}
 
-	size_t pixelSize = sizeof(uint16_t) * (size_t) maxNumPixels * (size_t) maxChannelNumber;
+	size_t pixelSize
+		= caerFrameEventPixelFormatBytes(pixelFormat, (size_t) maxNumPixels * (size_t) maxChannelNumber);
+	// Keep the pixels array a whole number of 16 bit values, it's still declared as such.
+	pixelSize = (pixelSize + 1) & ~((size_t) 0x01);
 	// '- sizeof(uint16_t)' to compensate for pixels[1] at end of struct for C++ compatibility.
 	size_t eventSize = (sizeof(struct caer_frame_event) - sizeof(uint16_t)) + pixelSize;
 
@@ -168,6 +222,31 @@ static inline caerFrameEventPacket caerFrameEventPacketAllocateNumPixels(
 		I32T(eventSize), offsetof(struct caer_frame_event, ts_endframe)));
 }
 
+/**
+ * Allocate a new frame events packet, passing the total number of maximum
+ * pixels instead of the maximum X/Y dimensions expected.
+ * Use free() to reclaim this memory.
+ * The frame events allocate memory for a maximum sized pixels array, depending
+ * on the parameters passed to this function, so that every event occupies the
+ * same amount of memory (constant size). The actual frames inside of it
+ * might be smaller than that, for example when using ROI, and their actual size
+ * is stored inside the frame event and should always be queried from there.
+ * The unused part of a pixels array is guaranteed to be zeros.
+ *
+ * @param eventCapacity the maximum number of events this packet will hold.
+ * @param eventSource the unique ID representing the source/generator of this packet.
+ * @param tsOverflow the current timestamp overflow counter value for this packet.
+ * @param maxNumPixels the maximum number of pixels that can be held by a frame event.
+ * @param maxChannelNumber the maximum expected number of channels for frames in this packet.
+ *
+ * @return a valid FrameEventPacket handle or NULL on error.
+ */
+static inline caerFrameEventPacket caerFrameEventPacketAllocateNumPixels(
+	int32_t eventCapacity, int16_t eventSource, int32_t tsOverflow, int32_t maxNumPixels, int16_t maxChannelNumber) {
+	return (caerFrameEventPacketAllocatePixelFormat(
+		eventCapacity, eventSource, tsOverflow, maxNumPixels, maxChannelNumber, PIXEL_FORMAT_16BIT));
+}
+
 /**
  * Allocate a new frame events packet.
  * Use free() to reclaim this memory.
@@ -660,6 +739,29 @@ static inline void caerFrameEventSetColorFilter(caerFrameEvent event, enum caer_
 	SET_NUMBITS32(event->info, FRAME_COLOR_FILTER_SHIFT, FRAME_COLOR_FILTER_MASK, colorFilter);
 }
 
+/**
+ * Get the format the pixel values are stored in.
+ * @param event a valid FrameEvent pointer. Cannot be NULL.
+ * @return pixel format identifier.
+ */
+static inline enum caer_frame_event_pixel_format caerFrameEventGetPixelFormat(caerFrameEventConst event) {
+	return ((enum caer_frame_event_pixel_format) U8T(
+		GET_NUMBITS32(event->info, FRAME_PIXEL_FORMAT_SHIFT, FRAME_PIXEL_FORMAT_MASK)));
+}
+
+/**
+ * Set the format the pixel values are stored in.
+ * This changes how much memory a frame needs, so it must be
+ * set before calling 'caerFrameEventSetLengthXLengthYChannelNumber()'.
+ * Existing pixel values are not converted.
+ * @param event a valid FrameEvent pointer. Cannot be NULL.
+ * @param pixelFormat pixel format identifier.
+ */
+static inline void caerFrameEventSetPixelFormat(caerFrameEvent event, enum caer_frame_event_pixel_format pixelFormat) {
+	CLEAR_NUMBITS32(event->info, FRAME_PIXEL_FORMAT_SHIFT, FRAME_PIXEL_FORMAT_MASK);
+	SET_NUMBITS32(event->info, FRAME_PIXEL_FORMAT_SHIFT, FRAME_PIXEL_FORMAT_MASK, pixelFormat);
+}
+
 /**
  * Get the actual X axis length for the current frame.
  *
@@ -716,7 +818,8 @@ static inline void caerFrameEventSetLengthXLengthYChannelNumber(caerFrameEvent e
 	}
 
 	// Verify lengths and color channels number don't exceed allocated space.
-	size_t neededMemory = (sizeof(uint16_t) * (size_t) lengthX * (size_t) lengthY * channelNumber);
+	size_t neededMemory = caerFrameEventPixelFormatBytes(
+		caerFrameEventGetPixelFormat(event), (size_t) lengthX * (size_t) lengthY * channelNumber);
 
 	if (neededMemory > caerFrameEventPacketGetPixelsSize(packet)) {
 		caerLogEHO(CAER_LOG_CRITICAL, "Frame Event",
@@ -748,14 +851,15 @@ static inline size_t caerFrameEventGetPixelsMaxIndex(caerFrameEventConst event)
 
 /**
  * Get the maximum size of the pixels array in bytes, in which
- * you can still get valid pixels.
+ * you can still get valid pixels. This depends on the pixel format.
  *
  * @param event a valid FrameEvent pointer. Cannot be NULL.
  *
  * @return maximum valid pixels array size in bytes.
  */
 static inline size_t caerFrameEventGetPixelsSize(caerFrameEventConst event) {
-	return (caerFrameEventGetPixelsMaxIndex(event) * sizeof(uint16_t));
+	return (
+		caerFrameEventPixelFormatBytes(caerFrameEventGetPixelFormat(event), caerFrameEventGetPixelsMaxIndex(event)));
 }
 
 /**
@@ -808,6 +912,72 @@ static inline void caerFrameEventSetPositionY(caerFrameEvent event, int32_t posi
 	event->positionY = I32T(htole32(U32T(positionY)));
 }
 
+/**
+ * Get the pixel value at the specified index into the pixel values,
+ * taking into account the pixel format. The index is the same as for
+ * 16 bit pixels: ((y * lengthX) + x) * channels + channel.
+ * No checks on the index are performed!
+ *
+ * @param event a valid FrameEvent pointer. Cannot be NULL.
+ * @param index pixel value index (unchecked).
+ *
+ * @return pixel value (normalized to 16 bit depth).
+ */
+static inline uint16_t caerFrameEventGetPixelAtIndexUnsafe(caerFrameEventConst event, size_t index) {
+	const uint8_t *bytes = (const uint8_t *) event->pixels;
+
+	switch (caerFrameEventGetPixelFormat(event)) {
+		case PIXEL_FORMAT_8BIT:
+			return (U16T(bytes[index] << 8));
+
+		case PIXEL_FORMAT_10BIT_PACKED: {
+			const uint8_t *group = bytes + ((index / 4) * 5);
+			size_t lowShift      = (index % 4) * 2;
+
+			return (U16T((group[index % 4] << 8) | (((group[4] >> lowShift) & 0x03) << 6)));
+		}
+
+		case PIXEL_FORMAT_16BIT:
+		default:
+			return (le16toh(event->pixels[index]));
+	}
+}
+
+/**
+ * Set the pixel value at the specified index into the pixel values,
+ * taking into account the pixel format. The index is the same as for
+ * 16 bit pixels: ((y * lengthX) + x) * channels + channel.
+ * Bits the pixel format can't hold are dropped.
+ * No checks on the index are performed!
+ *
+ * @param event a valid FrameEvent pointer. Cannot be NULL.
+ * @param index pixel value index (unchecked).
+ * @param pixelValue pixel value (normalized to 16 bit depth).
+ */
+static inline void caerFrameEventSetPixelAtIndexUnsafe(caerFrameEvent event, size_t index, uint16_t pixelValue) {
+	uint8_t *bytes = (uint8_t *) event->pixels;
+
+	switch (caerFrameEventGetPixelFormat(event)) {
+		case PIXEL_FORMAT_8BIT:
+			bytes[index] = U8T(pixelValue >> 8);
+			break;
+
+		case PIXEL_FORMAT_10BIT_PACKED: {
+			uint8_t *group  = bytes + ((index / 4) * 5);
+			size_t lowShift = (index % 4) * 2;
+
+			group[index % 4] = U8T(pixelValue >> 8);
+			group[4]         = U8T((group[4] & ~(0x03 << lowShift)) | (((pixelValue >> 6) & 0x03) << lowShift));
+			break;
+		}
+
+		case PIXEL_FORMAT_16BIT:
+		default:
+			event->pixels[index] = htole16(pixelValue);
+			break;
+	}
+}
+
 /**
  * Get the pixel value at the specified (X, Y) address.
  * (X, Y) are checked against the actual possible values for this frame.
@@ -841,7 +1011,7 @@ static inline uint16_t caerFrameEventGetPixel(caerFrameEventConst event, int32_t
 	}
 
 	// Get pixel value at specified position.
-	return (le16toh(event->pixels[(yAddress * xLength) + xAddress]));
+	return (caerFrameEventGetPixelAtIndexUnsafe(event, (size_t)((yAddress * xLength) + xAddress)));
 }
 
 /**
@@ -877,7 +1047,7 @@ static inline void caerFrameEventSetPixel(
 	}
 
 	// Set pixel value at specified position.
-	event->pixels[(yAddress * xLength) + xAddress] = htole16(pixelValue);
+	caerFrameEventSetPixelAtIndexUnsafe(event, (size_t)((yAddress * xLength) + xAddress), pixelValue);
 }
 
 /**
@@ -926,7 +1096,8 @@ static inline uint16_t caerFrameEventGetPixelForChannel(
 	}
 
 	// Get pixel value at specified position.
-	return (le16toh(event->pixels[(((yAddress * xLength) + xAddress) * U8T(channelNumber)) + channel]));
+	return (caerFrameEventGetPixelAtIndexUnsafe(
+		event, (size_t)((((yAddress * xLength) + xAddress) * U8T(channelNumber)) + channel)));
 }
 
 /**
@@ -974,7 +1145,8 @@ static inline void caerFrameEventSetPixelForChannel(
 	}
 
 	// Set pixel value at specified position.
-	event->pixels[(((yAddress * xLength) + xAddress) * U8T(channelNumber)) + channel] = htole16(pixelValue);
+	caerFrameEventSetPixelAtIndexUnsafe(
+		event, (size_t)((((yAddress * xLength) + xAddress) * U8T(channelNumber)) + channel), pixelValue);
 }
 
 /**
@@ -990,7 +1162,8 @@ static inline void caerFrameEventSetPixelForChannel(
  */
 static inline uint16_t caerFrameEventGetPixelUnsafe(caerFrameEventConst event, int32_t xAddress, int32_t yAddress) {
 	// Get pixel value at specified position.
-	return (le16toh(event->pixels[(yAddress * caerFrameEventGetLengthX(event)) + xAddress]));
+	return (
+		caerFrameEventGetPixelAtIndexUnsafe(event, (size_t)((yAddress * caerFrameEventGetLengthX(event)) + xAddress)));
 }
 
 /**
@@ -1006,7 +1179,8 @@ static inline uint16_t caerFrameEventGetPixelUnsafe(caerFrameEventConst event, i
 static inline void caerFrameEventSetPixelUnsafe(
 	caerFrameEvent event, int32_t xAddress, int32_t yAddress, uint16_t pixelValue) {
 	// Set pixel value at specified position.
-	event->pixels[(yAddress * caerFrameEventGetLengthX(event)) + xAddress] = htole16(pixelValue);
+	caerFrameEventSetPixelAtIndexUnsafe(
+		event, (size_t)((yAddress * caerFrameEventGetLengthX(event)) + xAddress), pixelValue);
 }
 
 /**
@@ -1026,8 +1200,8 @@ static inline uint16_t caerFrameEventGetPixelForChannelUnsafe(
 	caerFrameEventConst event, int32_t xAddress, int32_t yAddress, uint8_t channel) {
 	enum caer_frame_event_color_channels channelNumber = caerFrameEventGetChannelNumber(event);
 	// Get pixel value at specified position.
-	return (le16toh(
-		event->pixels[(((yAddress * caerFrameEventGetLengthX(event)) + xAddress) * U8T(channelNumber)) + channel]));
+	return (caerFrameEventGetPixelAtIndexUnsafe(
+		event, (size_t)((((yAddress * caerFrameEventGetLengthX(event)) + xAddress) * U8T(channelNumber)) + channel)));
 }
 
 /**
@@ -1046,8 +1220,9 @@ static inline void caerFrameEventSetPixelForChannelUnsafe(
 	caerFrameEvent event, int32_t xAddress, int32_t yAddress, uint8_t channel, uint16_t pixelValue) {
 	enum caer_frame_event_color_channels channelNumber = caerFrameEventGetChannelNumber(event);
 	// Set pixel value at specified position.
-	event->pixels[(((yAddress * caerFrameEventGetLengthX(event)) + xAddress) * U8T(channelNumber)) + channel]
-		= htole16(pixelValue);
+	caerFrameEventSetPixelAtIndexUnsafe(event,
+		(size_t)((((yAddress * caerFrameEventGetLengthX(event)) + xAddress) * U8T(channelNumber)) + channel),
+		pixelValue);
 }
 
 /**
@@ -1056,6 +1231,8 @@ static inline void caerFrameEventSetPixelForChannelUnsafe(
  * No checks at all are performed at any point, nor any
  * conversions, use this at your own risk!
  * Remember that the 16 bit pixel values are in little-endian!
+ * Only valid for frames in the PIXEL_FORMAT_16BIT pixel format,
+ * use 'caerFrameEventGetPixelBytesUnsafe()' for the others.
  * The pixel array is laid out row by row (increasing X axis),
  * going from top to bottom (increasing Y axis).
  *
@@ -1074,6 +1251,8 @@ static inline uint16_t *caerFrameEventGetPixelArrayUnsafe(caerFrameEvent event)
  * No checks at all are performed at any point, nor any
  * conversions, use this at your own risk!
  * Remember that the 16 bit pixel values are in little-endian!
+ * Only valid for frames in the PIXEL_FORMAT_16BIT pixel format,
+ * use 'caerFrameEventGetPixelBytesUnsafeConst()' for the others.
  * The pixel array is laid out row by row (increasing X axis),
  * going from top to bottom (increasing Y axis).
  *
@@ -1086,6 +1265,38 @@ static inline const uint16_t *caerFrameEventGetPixelArrayUnsafeConst(caerFrameEv
 	return (event->pixels);
 }
 
+/**
+ * Get a direct pointer to the underlying pixels array, as bytes.
+ * This can be used to both get and set values, in any pixel format,
+ * see 'enum caer_frame_event_pixel_format' for their layout.
+ * No checks at all are performed at any point, nor any
+ * conversions, use this at your own risk!
+ *
+ * @param event a valid FrameEvent pointer. Cannot be NULL.
+ *
+ * @return the pixels array as bytes.
+ */
+static inline uint8_t *caerFrameEventGetPixelBytesUnsafe(caerFrameEvent event) {
+	// Get pixels array.
+	return ((uint8_t *) event->pixels);
+}
+
+/**
+ * Get a direct read-only pointer to the underlying pixels array, as bytes.
+ * This can be used to only get values, in any pixel format,
+ * see 'enum caer_frame_event_pixel_format' for their layout.
+ * No checks at all are performed at any point, nor any
+ * conversions, use this at your own risk!
+ *
+ * @param event a valid FrameEvent pointer. Cannot be NULL.
+ *
+ * @return the read-only pixels array as bytes.
+ */
+static inline const uint8_t *caerFrameEventGetPixelBytesUnsafeConst(caerFrameEventConst event) {
+	// Get pixels array.
+	return ((const uint8_t *) event->pixels);
+}
+
 /**
  * Iterator over all frame events in a packet.
  * Returns the current index in the 'caerFrameIteratorCounter' variable of type
@@ -0,0 +1,166 @@
+/**
+ * @file chain.h
+ *
+ * The filter chain runs several processing stages on polarity event
+ * packets in a single pass: each valid event goes through all stages,
+ * in the order they were added, before moving on to the next one, so
+ * that event data is only read from memory once, instead of once per
+ * filter. An event dropped by a stage is invalidated and not passed
+ * on to the following stages, exactly as if each stage had been
+ * applied to the whole packet one after the other.
+ * Please note that the filter chain is not thread-safe, all function
+ * calls should happen on the same thread, unless you take care that
+ * they never overlap.
+ */
+
+#ifndef LIBCAER_FILTERS_CHAIN_H_
+#define LIBCAER_FILTERS_CHAIN_H_
+
+#include "../events/polarity.h"
+#include "dvs_noise.h"
+#include "dvs_spatial.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Pointer to filter chain structure (private).
+ */
+typedef struct caer_filter_chain *caerFilterChain;
+
+/**
+ * User callback stage, called for each event reaching it.
+ * The event can be modified (for example its address), the following
+ * stages will see the modified event.
+ *
+ * @param event the current polarity event, always valid.
+ * @param packet the packet the event belongs to.
+ * @param userData the user data pointer given when adding the stage.
+ *
+ * @return true to keep the event, false to drop (invalidate) it.
+ */
+typedef bool (*caerFilterChainEventCallback)(caerPolarityEvent event, caerPolarityEventPacket packet, void *userData);
+
+/**
+ * Allocate memory and initialize an empty filter chain.
+ *
+ * @return filter chain instance, NULL on error.
+ */
+caerFilterChain caerFilterChainInitialize(void);
+
+/**
+ * Destroy a filter chain instance and free its memory.
+ * Filters referenced by stages, such as DVS noise or spatial filters,
+ * are not destroyed and must be freed separately.
+ *
+ * @param filterChain a valid filter chain instance.
+ */
+void caerFilterChainDestroy(caerFilterChain filterChain);
+
+/**
+ * Apply all stages of the filter chain to the given polarity events packet,
+ * in one pass. Events dropped by any stage are marked as invalid.
+ *
+ * @param filterChain a valid filter chain instance.
+ * @param polarity a valid polarity event packet. If NULL, no operation
+ *                 is performed.
+ */
+void caerFilterChainApply(caerFilterChain filterChain, caerPolarityEventPacket polarity);
+
+/**
+ * Get the number of stages in the filter chain.
+ *
+ * @param filterChain a valid filter chain instance.
+ *
+ * @return number of stages.
+ */
+size_t caerFilterChainGetStagesNumber(caerFilterChain filterChain);
+
+/**
+ * Get the number of events dropped by a stage of the filter chain,
+ * since it was added.
+ *
+ * @param filterChain a valid filter chain instance.
+ * @param stage the stage index, in the order stages were added (first is 0).
+ *
+ * @return number of dropped events, 0 if the stage does not exist.
+ */
+uint64_t caerFilterChainGetStageDropped(caerFilterChain filterChain, size_t stage);
+
+/**
+ * Add a DVS noise filter stage. The noise filter is referenced, not copied,
+ * so it can still be configured normally and must stay valid for as long
+ * as the filter chain is used.
+ *
+ * @param filterChain a valid filter chain instance.
+ * @param noiseFilter a valid DVS noise filter instance.
+ *
+ * @return true if operation successful, false otherwise.
+ */
+bool caerFilterChainAddDVSNoise(caerFilterChain filterChain, caerFilterDVSNoise noiseFilter);
+
+/**
+ * Add a DVS spatial filter stage (crop, subsample, flip, transpose).
+ * Following stages see the transformed addresses. The spatial filter is
+ * referenced, not copied, so it can still be configured normally and must
+ * stay valid for as long as the filter chain is used.
+ *
+ * @param filterChain a valid filter chain instance.
+ * @param spatialFilter a valid DVS spatial filter instance.
+ *
+ * @return true if operation successful, false otherwise.
+ */
+bool caerFilterChainAddDVSSpatial(caerFilterChain filterChain, caerFilterDVSSpatial spatialFilter);
+
+/**
+ * Add a region of interest (ROI) stage: only events inside the given
+ * rectangle pass, all limits are inclusive. Addresses are not changed.
+ *
+ * @param filterChain a valid filter chain instance.
+ * @param startX first column of the region.
+ * @param startY first row of the region.
+ * @param endX last column of the region.
+ * @param endY last row of the region.
+ *
+ * @return true if operation successful, false otherwise.
+ */
+bool caerFilterChainAddROI(caerFilterChain filterChain, uint16_t startX, uint16_t startY, uint16_t endX, uint16_t endY);
+
+/**
+ * Add a decimation stage: only one out of every 'factor' events reaching
+ * this stage passes. The count continues across packets.
+ *
+ * @param filterChain a valid filter chain instance.
+ * @param factor decimation factor, 0 and 1 let all events pass.
+ *
+ * @return true if operation successful, false otherwise.
+ */
+bool caerFilterChainAddDecimation(caerFilterChain filterChain, uint32_t factor);
+
+/**
+ * Add a polarity selection stage: only events of the given polarity pass.
+ *
+ * @param filterChain a valid filter chain instance.
+ * @param polarity true to keep only ON events, false to keep only OFF events.
+ *
+ * @return true if operation successful, false otherwise.
+ */
+bool caerFilterChainAddPolaritySelect(caerFilterChain filterChain, bool polarity);
+
+/**
+ * Add a user callback stage, see caerFilterChainEventCallback.
+ *
+ * @param filterChain a valid filter chain instance.
+ * @param callback function to call for each event reaching this stage.
+ * @param userData pointer passed to the callback as-is, can be NULL.
+ *
+ * @return true if operation successful, false otherwise.
+ */
+bool caerFilterChainAddCallback(caerFilterChain filterChain, caerFilterChainEventCallback callback, void *userData);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBCAER_FILTERS_CHAIN_H_ */
@@ -2,8 +2,9 @@
  * @file dvs_noise.h
  *
  * The DVS noise filter combines a HotPixel filter (high activity pixels),
- * a Background-Activity filter (uncorrelated events), and a
- * Refractory Period filter (limit event rate of a pixel).
+ * a Background-Activity filter (uncorrelated events), a
+ * Refractory Period filter (limit event rate of a pixel), and a
+ * Rate Limiter (limit overall event rate, adapting a refractory period).
  * The HotPixel and Background-Activity filters reduce noise due
  * to transistor mismatch, the Refractory Period filter can reduce
  * the event rate and is efficient to implement together with the
@@ -121,6 +122,8 @@ bool caerFilterDVSNoiseConfigGet(caerFilterDVSNoise noiseFilter, uint8_t paramAd
  * Get an array of currently learned hot pixels, in order of activity
  * (most active first, least active last).
  * Useful for working with hardware-based pixel filtering (FPGA/CPLD).
+ * With continuous learning enabled, this is a snapshot of the
+ * current hot pixels set.
  *
  * @param noiseFilter a valid DVS noise filter instance.
  * @param hotPixels array of DVS pixel addresses, sorted by activity (most active first).
@@ -132,6 +135,38 @@ bool caerFilterDVSNoiseConfigGet(caerFilterDVSNoise noiseFilter, uint8_t paramAd
  */
 ssize_t caerFilterDVSNoiseGetHotPixels(caerFilterDVSNoise noiseFilter, caerFilterDVSPixel *hotPixels);
 
+/**
+ * Save the learned state of the DVS noise filter to a binary file:
+ * the hot pixels array and, optionally, a snapshot of the pixel
+ * timestamps map. Timestamps are stored relative to the most recent
+ * one, as 32bit values (ages above ~35 minutes are saturated), so
+ * that they can be loaded back against a different timebase.
+ * Configuration parameters are not saved.
+ *
+ * @param noiseFilter a valid DVS noise filter instance.
+ * @param fileName path of the file to write, will be overwritten if it exists.
+ * @param saveTimestamps also save a snapshot of the timestamps map.
+ *
+ * @return true if operation successful, false otherwise.
+ */
+bool caerFilterDVSNoiseStateSave(caerFilterDVSNoise noiseFilter, const char *fileName, bool saveTimestamps);
+
+/**
+ * Load a learned state, as saved by caerFilterDVSNoiseStateSave(), into
+ * the DVS noise filter, replacing the current hot pixels array and, if
+ * present in the file, the timestamps map. The loaded timestamps are moved
+ * to the timebase of the next packet passed to the filter, as if the saved
+ * state had been recorded right before it.
+ * The file must have been saved by a filter with the same resolution.
+ * On failure, the filter state is left unchanged.
+ *
+ * @param noiseFilter a valid DVS noise filter instance.
+ * @param fileName path of the file to read.
+ *
+ * @return true if operation successful, false otherwise.
+ */
+bool caerFilterDVSNoiseStateLoad(caerFilterDVSNoise noiseFilter, const char *fileName);
+
 /**
  * DVS HotPixel Filter:
  * Turn on learning to determine which pixels are hot, meaning abnormally
@@ -275,6 +310,67 @@ ssize_t caerFilterDVSNoiseGetHotPixels(caerFilterDVSNoise noiseFilter, caerFilte
  */
 #define CAER_FILTER_DVS_BACKGROUND_ACTIVITY_CHECK_POLARITY 16
 
+/**
+ * DVS HotPixel Filter:
+ * enable continuous learning of hot pixels. Instead of a one-shot
+ * learning window, each pixel keeps an activity estimate that decays
+ * by half every CAER_FILTER_DVS_HOTPIXEL_TIME µs. A pixel is added to
+ * the hot pixels set as soon as its estimate reaches
+ * CAER_FILTER_DVS_HOTPIXEL_COUNT, and is removed again once it falls
+ * below half of that. The set is updated incrementally while filtering
+ * goes on, so hot pixels that change over time (with temperature, for
+ * example) are followed without interruptions.
+ * Any previously learned hot pixels are kept when enabling this, and
+ * are then forgotten if they are not active enough anymore.
+ */
+#define CAER_FILTER_DVS_HOTPIXEL_CONTINUOUS 23
+
+/**
+ * DVS Rate Limiter:
+ * enable the rate limiter. It keeps the rate of events leaving the
+ * filter close to CAER_FILTER_DVS_RATE_LIMIT_TARGET, by applying a
+ * refractory period to all pixels, which is adapted at the end of every
+ * CAER_FILTER_DVS_RATE_LIMIT_WINDOW to the measured output rate.
+ * Since the same period applies everywhere, events are reduced evenly
+ * over the whole sensor, the most active pixels first, instead of
+ * cutting off whole parts of the scene.
+ * It is applied last, only to events that passed all other filters.
+ */
+#define CAER_FILTER_DVS_RATE_LIMIT_ENABLE 24
+/**
+ * DVS Rate Limiter:
+ * target output event rate, in events per second.
+ */
+#define CAER_FILTER_DVS_RATE_LIMIT_TARGET 25
+/**
+ * DVS Rate Limiter:
+ * time window, in µs, over which the output event rate is measured
+ * before adapting the refractory period. Shorter windows react faster
+ * to activity spikes, longer ones give a steadier rate.
+ */
+#define CAER_FILTER_DVS_RATE_LIMIT_WINDOW 26
+/**
+ * DVS Rate Limiter:
+ * currently applied refractory period, in µs (read-only).
+ * Zero when the event rate is below target.
+ */
+#define CAER_FILTER_DVS_RATE_LIMIT_PERIOD 27
+/**
+ * DVS Rate Limiter:
+ * number of events filtered out by the rate limiter.
+ */
+#define CAER_FILTER_DVS_RATE_LIMIT_STATISTICS 28
+/**
+ * DVS Rate Limiter:
+ * number of ON events filtered out by the rate limiter.
+ */
+#define CAER_FILTER_DVS_RATE_LIMIT_STATISTICS_ON 29
+/**
+ * DVS Rate Limiter:
+ * number of OFF events filtered out by the rate limiter.
+ */
+#define CAER_FILTER_DVS_RATE_LIMIT_STATISTICS_OFF 30
+
 #ifdef __cplusplus
 }
 #endif
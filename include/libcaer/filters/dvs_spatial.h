@@ -0,0 +1,166 @@
+/**
+ * @file dvs_spatial.h
+ *
+ * The DVS spatial filter crops polarity events to a region of interest,
+ * subsamples them by integer factors, and flips and/or transposes their
+ * addresses, all in one branch-free pass over the event addresses.
+ * It can work in-place, invalidating events outside of the
+ * region, or produce a new, compacted packet of only the resulting events.
+ * Transformations are applied in this order: crop, subsample, flip, transpose.
+ * Rotations are obtained by combining flip and transpose (Y axis pointing
+ * down): 90° clockwise is flip Y + transpose, 90° counter-clockwise is
+ * flip X + transpose, 180° is flip X + flip Y.
+ * Please note that the filter is not thread-safe, all function calls
+ * should happen on the same thread, unless you take care that they
+ * never overlap.
+ */
+
+#ifndef LIBCAER_FILTERS_DVS_SPATIAL_H_
+#define LIBCAER_FILTERS_DVS_SPATIAL_H_
+
+#include "../events/polarity.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Pointer to DVS spatial filter structure (private).
+ */
+typedef struct caer_filter_dvs_spatial *caerFilterDVSSpatial;
+
+/**
+ * Allocate memory and initialize the DVS spatial filter.
+ * At initialization, the region of interest covers the whole sensor,
+ * and no subsampling, flipping or transposing is done.
+ *
+ * @param sizeX maximum X axis resolution.
+ * @param sizeY maximum Y axis resolution.
+ *
+ * @return DVS spatial filter instance, NULL on error.
+ */
+caerFilterDVSSpatial caerFilterDVSSpatialInitialize(uint16_t sizeX, uint16_t sizeY);
+
+/**
+ * Destroy a DVS spatial filter instance and free its memory.
+ *
+ * @param spatialFilter a valid DVS spatial filter instance.
+ */
+void caerFilterDVSSpatialDestroy(caerFilterDVSSpatial spatialFilter);
+
+/**
+ * Apply the DVS spatial filter to the given polarity events packet, in-place.
+ * Valid events inside the region of interest get their addresses changed,
+ * all others are marked as invalid.
+ *
+ * @param spatialFilter a valid DVS spatial filter instance.
+ * @param polarity a valid polarity event packet. If NULL, no operation
+ *                 is performed.
+ */
+void caerFilterDVSSpatialApply(caerFilterDVSSpatial spatialFilter, caerPolarityEventPacket polarity);
+
+/**
+ * Apply the DVS spatial filter to the given polarity events packet, putting
+ * the results into a new packet, which only contains the resulting valid
+ * events. The original packet is not changed.
+ *
+ * @param spatialFilter a valid DVS spatial filter instance.
+ * @param polarity a valid polarity event packet.
+ *
+ * @return a new polarity event packet, NULL if no events remain
+ *         or on error. Remember to free() it once done!
+ */
+caerPolarityEventPacket caerFilterDVSSpatialApplyCopy(
+	caerFilterDVSSpatial spatialFilter, caerPolarityEventPacketConst polarity);
+
+/**
+ * Set DVS spatial filter configuration parameters.
+ *
+ * @param spatialFilter a valid DVS spatial filter instance.
+ * @param paramAddr a configuration parameter address, see defines CAER_FILTER_DVS_SPATIAL_*.
+ * @param param a configuration parameter value integer.
+ *
+ * @return true if operation successful, false otherwise.
+ */
+bool caerFilterDVSSpatialConfigSet(caerFilterDVSSpatial spatialFilter, uint8_t paramAddr, uint64_t param);
+
+/**
+ * Get DVS spatial filter configuration parameters.
+ *
+ * @param spatialFilter a valid DVS spatial filter instance.
+ * @param paramAddr a configuration parameter address, see defines CAER_FILTER_DVS_SPATIAL_*.
+ * @param param a pointer to a configuration parameter value integer,
+ *              in which to store the current value.
+ *
+ * @return true if operation successful, false otherwise.
+ */
+bool caerFilterDVSSpatialConfigGet(caerFilterDVSSpatial spatialFilter, uint8_t paramAddr, uint64_t *param);
+
+/**
+ * DVS Spatial Filter:
+ * first column (inclusive) of the region of interest.
+ * If the region is empty (start after end), all events are dropped.
+ */
+#define CAER_FILTER_DVS_SPATIAL_CROP_START_X 0
+/**
+ * DVS Spatial Filter:
+ * first row (inclusive) of the region of interest.
+ */
+#define CAER_FILTER_DVS_SPATIAL_CROP_START_Y 1
+/**
+ * DVS Spatial Filter:
+ * last column (inclusive) of the region of interest.
+ */
+#define CAER_FILTER_DVS_SPATIAL_CROP_END_X 2
+/**
+ * DVS Spatial Filter:
+ * last row (inclusive) of the region of interest.
+ */
+#define CAER_FILTER_DVS_SPATIAL_CROP_END_Y 3
+/**
+ * DVS Spatial Filter:
+ * subsampling factor on the X axis, any integer from 1 up.
+ * Addresses relative to the region start are divided by this.
+ */
+#define CAER_FILTER_DVS_SPATIAL_SUBSAMPLE_X 4
+/**
+ * DVS Spatial Filter:
+ * subsampling factor on the Y axis, any integer from 1 up.
+ */
+#define CAER_FILTER_DVS_SPATIAL_SUBSAMPLE_Y 5
+/**
+ * DVS Spatial Filter:
+ * mirror X addresses in the output (left-right flip).
+ */
+#define CAER_FILTER_DVS_SPATIAL_FLIP_X 6
+/**
+ * DVS Spatial Filter:
+ * mirror Y addresses in the output (up-down flip).
+ */
+#define CAER_FILTER_DVS_SPATIAL_FLIP_Y 7
+/**
+ * DVS Spatial Filter:
+ * swap X and Y addresses in the output (transpose), applied last.
+ */
+#define CAER_FILTER_DVS_SPATIAL_TRANSPOSE 8
+/**
+ * DVS Spatial Filter:
+ * output X axis resolution, after all transformations (read-only).
+ */
+#define CAER_FILTER_DVS_SPATIAL_OUTPUT_SIZE_X 9
+/**
+ * DVS Spatial Filter:
+ * output Y axis resolution, after all transformations (read-only).
+ */
+#define CAER_FILTER_DVS_SPATIAL_OUTPUT_SIZE_Y 10
+/**
+ * DVS Spatial Filter:
+ * number of events dropped for being outside the region of interest.
+ */
+#define CAER_FILTER_DVS_SPATIAL_STATISTICS 11
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* LIBCAER_FILTERS_DVS_SPATIAL_H_ */
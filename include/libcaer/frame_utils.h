@@ -11,6 +11,7 @@
 #define LIBCAER_FRAME_UTILS_H_
 
 #include "events/frame.h"
+#include "events/polarity.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -34,6 +35,8 @@ enum caer_frame_utils_contrast_types {
 	CONTRAST_OPENCV_HISTOGRAM_EQUALIZATION = 2,
 	CONTRAST_OPENCV_CLAHE                  = 3,
 #endif
+	CONTRAST_HISTOGRAM_EQUALIZATION = 4,
+	CONTRAST_CLAHE                  = 5,
 };
 
 void caerFrameUtilsDemosaic(
@@ -41,6 +44,67 @@ void caerFrameUtilsDemosaic(
 void caerFrameUtilsContrast(
 	caerFrameEventConst inputFrame, caerFrameEvent outputFrame, enum caer_frame_utils_contrast_types contrastType);
 
+/**
+ * Convert a frame to 8bit pixels for display, doing standard contrast
+ * enhancement, demosaicing and 8bit conversion in one pass over the pixels.
+ * Only DEMOSAIC_STANDARD (RGB output) and DEMOSAIC_TO_GRAY (grayscale output)
+ * are supported. Frames without a color filter are not demosaiced, and
+ * always result in grayscale output.
+ *
+ * @param inputFrame a valid frame with only one channel (intensity).
+ * @param outputPixels array of (lengthX * lengthY * output channels) bytes,
+ *                     same layout as the pixels of a frame.
+ * @param demosaicType type of demosaic to apply.
+ */
+void caerFrameUtilsDemosaicContrast8Bit(
+	caerFrameEventConst inputFrame, uint8_t *outputPixels, enum caer_frame_utils_demosaic_types demosaicType);
+
+/**
+ * Convert the pixels of a frame to the pixel format of another frame.
+ * The output frame must have its pixel format, lengths and channels
+ * number already set, and they must match the input frame's (except
+ * the pixel format). Going to a format with fewer bits per value keeps
+ * the most significant bits, going to one with more bits pads with zeros.
+ *
+ * @param inputFrame a valid frame, in any pixel format.
+ * @param outputFrame a valid frame, with its pixel format set to the wanted one.
+ */
+void caerFrameUtilsConvertPixelFormat(caerFrameEventConst inputFrame, caerFrameEvent outputFrame);
+
+enum caer_frame_utils_accumulate_types {
+	ACCUMULATE_COUNT    = 0,
+	ACCUMULATE_POLARITY = 1,
+};
+
+/**
+ * Integrate the polarity events that happened during the exposure
+ * of a frame into an accumulation image with the same geometry as
+ * the frame, for APS/DVS fusion (deblurring for example).
+ * The exposure window goes from the start of exposure (inclusive)
+ * to the end of exposure (exclusive). Event addresses are moved
+ * into frame coordinates using the frame position, events that
+ * fall outside the frame are ignored, as are invalid events.
+ * The accumulation image is not cleared, values are added to it,
+ * so events from consecutive packets can be integrated one after
+ * the other. Events in a packet must be ordered by timestamp, as
+ * they come from the devices.
+ * Large numbers of events are split over multiple threads.
+ *
+ * @param frame a valid frame, only its header is used.
+ * @param framePacket the packet containing the frame, for its 64bit timestamps.
+ * @param polarity a valid polarity event packet.
+ * @param accumulation array of (lengthX * lengthY) integers, same layout
+ *                     as the pixels of a grayscale frame.
+ * @param accumulateType ACCUMULATE_COUNT adds one for each event,
+ *                       ACCUMULATE_POLARITY adds one for ON and
+ *                       subtracts one for OFF events.
+ *
+ * @return number of events integrated into the accumulation image.
+ */
+size_t caerFrameUtilsAccumulateExposureEvents(caerFrameEventConst frame, caerFrameEventPacketConst framePacket,
+	caerPolarityEventPacketConst polarity, int32_t *accumulation,
+	enum caer_frame_utils_accumulate_types accumulateType);
+
 enum caer_frame_utils_pixel_color { PX_COLOR_R, PX_COLOR_B, PX_COLOR_G1, PX_COLOR_G2, PX_COLOR_W };
 
 enum caer_frame_utils_pixel_color caerFrameUtilsPixelColor(
@@ -0,0 +1,119 @@
+#ifndef LIBCAER_ACCUMULATOR_HPP_
+#define LIBCAER_ACCUMULATOR_HPP_
+
+#include "events/frame.hpp"
+#include "events/polarity.hpp"
+
+#include <libcaer/accumulator.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace libcaer {
+namespace accumulator {
+
+class Accumulator {
+private:
+	std::shared_ptr<struct caer_accumulator> handle;
+	uint16_t sizeX;
+	uint16_t sizeY;
+
+public:
+	Accumulator(uint16_t sizeX_, uint16_t sizeY_) : sizeX(sizeX_), sizeY(sizeY_) {
+		caerAccumulator h = caerAccumulatorInitialize(sizeX, sizeY);
+
+		// Handle constructor failure.
+		if (h == nullptr) {
+			std::string exc = "Failed to initialize event accumulator, sizeX=" + std::to_string(sizeX)
+							  + ", sizeY=" + std::to_string(sizeY) + ".";
+			throw std::runtime_error(exc);
+		}
+
+		// Use stateless lambda for shared_ptr custom deleter.
+		auto deleteDeviceHandle = [](caerAccumulator ah) {
+			// Run destructor, free all memory.
+			// Never fails in current implementation.
+			caerAccumulatorDestroy(ah);
+		};
+
+		handle = std::shared_ptr<struct caer_accumulator>(h, deleteDeviceHandle);
+	}
+
+	~Accumulator() = default;
+
+	std::string toString() const noexcept {
+		return ("Event accumulator");
+	}
+
+	void configSet(uint8_t paramAddr, uint64_t param) const {
+		bool success = caerAccumulatorConfigSet(handle.get(), paramAddr, param);
+		if (!success) {
+			std::string exc = toString() + ": failed to set configuration parameter, paramAddr="
+							  + std::to_string(paramAddr) + ", param=" + std::to_string(param) + ".";
+			throw std::runtime_error(exc);
+		}
+	}
+
+	void configGet(uint8_t paramAddr, uint64_t *param) const {
+		bool success = caerAccumulatorConfigGet(handle.get(), paramAddr, param);
+		if (!success) {
+			std::string exc
+				= toString() + ": failed to get configuration parameter, paramAddr=" + std::to_string(paramAddr) + ".";
+			throw std::runtime_error(exc);
+		}
+	}
+
+	uint64_t configGet(uint8_t paramAddr) const {
+		uint64_t param = 0;
+		configGet(paramAddr, &param);
+		return (param);
+	}
+
+	void accumulate(caerPolarityEventPacketConst polarity) const noexcept {
+		caerAccumulatorAccumulate(handle.get(), polarity);
+	}
+
+	void accumulate(const libcaer::events::PolarityEventPacket &polarity) const noexcept {
+		caerAccumulatorAccumulate(handle.get(), (caerPolarityEventPacketConst) polarity.getHeaderPointer());
+	}
+
+	void accumulate(const libcaer::events::PolarityEventPacket *polarity) const noexcept {
+		if (polarity != nullptr) {
+			caerAccumulatorAccumulate(handle.get(), (caerPolarityEventPacketConst) polarity->getHeaderPointer());
+		}
+	}
+
+	void reset() const noexcept {
+		caerAccumulatorReset(handle.get());
+	}
+
+	void getBuffer(float *buffer, int64_t timestamp) const noexcept {
+		caerAccumulatorGetBuffer(handle.get(), buffer, timestamp);
+	}
+
+	std::vector<float> getBuffer(int64_t timestamp) const {
+		size_t planes = (configGet(CAER_ACCUMULATOR_TYPE) == ACCUMULATOR_VOXEL_GRID)
+							? (static_cast<size_t>(configGet(CAER_ACCUMULATOR_VOXEL_BINS)))
+							: (1);
+
+		std::vector<float> buffer(static_cast<size_t>(sizeX) * static_cast<size_t>(sizeY) * planes);
+
+		caerAccumulatorGetBuffer(handle.get(), buffer.data(), timestamp);
+
+		return (buffer);
+	}
+
+	std::unique_ptr<libcaer::events::FrameEventPacket> generateFrame(int64_t timestamp, int16_t eventSource) const {
+		caerFrameEventPacket frame = caerAccumulatorGenerateFrame(handle.get(), timestamp, eventSource);
+		if (frame == nullptr) {
+			throw std::runtime_error(toString() + ": failed to generate frame.");
+		}
+
+		return (std::unique_ptr<libcaer::events::FrameEventPacket>(new libcaer::events::FrameEventPacket(frame, true)));
+	}
+};
+} // namespace accumulator
+} // namespace libcaer
+
+#endif /* LIBCAER_ACCUMULATOR_HPP_ */
@@ -38,6 +38,30 @@ public:
 		}
 	}
 
+	void sendDataToUSBAsync(const uint32_t *data, size_t numConfig,
+		void (*uploadCallback)(void *uploadCallbackPtr, bool success), void *uploadCallbackPtr) const {
+		bool success
+			= caerDynapseSendDataToUSBAsync(handle.get(), data, numConfig, uploadCallback, uploadCallbackPtr);
+		if (!success) {
+			std::string exc = toString() + ": failed to start USB config data upload to device, numConfig="
+							  + std::to_string(numConfig) + ".";
+			throw std::runtime_error(exc);
+		}
+	}
+
+	void writeNetwork(const struct caer_dynapse_connection *connections, size_t numConnections) const {
+		bool success = caerDynapseWriteNetwork(handle.get(), connections, numConnections);
+		if (!success) {
+			std::string exc = toString() + ": failed to write network to device, numConnections="
+							  + std::to_string(numConnections) + ".";
+			throw std::runtime_error(exc);
+		}
+	}
+
+	void writeNetwork(const std::vector<struct caer_dynapse_connection> &connections) const {
+		writeNetwork(connections.data(), connections.size());
+	}
+
 	void writeSramWords(const uint16_t *data, uint32_t baseAddr, size_t numWords) const {
 		bool success = caerDynapseWriteSramWords(handle.get(), data, baseAddr, numWords);
 		if (!success) {
@@ -47,6 +71,17 @@ public:
 		}
 	}
 
+	void writeSramWordsAsync(const uint16_t *data, uint32_t baseAddr, size_t numWords,
+		void (*uploadCallback)(void *uploadCallbackPtr, bool success), void *uploadCallbackPtr) const {
+		bool success = caerDynapseWriteSramWordsAsync(
+			handle.get(), data, baseAddr, numWords, uploadCallback, uploadCallbackPtr);
+		if (!success) {
+			std::string exc = toString() + ": failed to start SRAM words upload to FPGA SRAM, baseAddr="
+							  + std::to_string(baseAddr) + ", numWords=" + std::to_string(numWords) + ".";
+			throw std::runtime_error(exc);
+		}
+	}
+
 	void writePoissonSpikeRate(uint16_t neuronAddr, float rateHz) const {
 		bool success = caerDynapseWritePoissonSpikeRate(handle.get(), neuronAddr, rateHz);
 		if (!success) {
@@ -58,6 +58,12 @@ struct FrameEvent : public caer_frame_event {
 		BWRG = 8, //!< Modified Bayer color filter, with white (pass all light) instead of extra green. Variation 4.
 	};
 
+	enum class pixelFormat {
+		PIXEL_16BIT        = 0, //!< 16 bit little-endian unsigned integers, one per value.
+		PIXEL_8BIT         = 1, //!< 8 bit unsigned integers, one per value (8 most significant bits).
+		PIXEL_10BIT_PACKED = 2, //!< 10 bit values, packed four into five bytes (10 most significant bits).
+	};
+
 	int32_t getTSStartOfFrame() const noexcept {
 		return (caerFrameEventGetTSStartOfFrame(this));
 	}
@@ -168,6 +174,15 @@ struct FrameEvent : public caer_frame_event {
 											   static_cast<typename std::underlying_type<colorFilter>::type>(cFilter)));
 	}
 
+	pixelFormat getPixelFormat() const noexcept {
+		return (static_cast<pixelFormat>(caerFrameEventGetPixelFormat(this)));
+	}
+
+	void setPixelFormat(pixelFormat pFormat) noexcept {
+		caerFrameEventSetPixelFormat(this, static_cast<enum caer_frame_event_pixel_format>(
+											   static_cast<typename std::underlying_type<pixelFormat>::type>(pFormat)));
+	}
+
 	int32_t getLengthX() const noexcept {
 		return (caerFrameEventGetLengthX(this));
 	}
@@ -189,7 +204,8 @@ struct FrameEvent : public caer_frame_event {
 			throw std::invalid_argument("Negative lengths or channel number not allowed.");
 		}
 
-		size_t neededMemory = (sizeof(uint16_t) * static_cast<size_t>(lenX) * static_cast<size_t>(lenY) * cNumberEnum);
+		size_t neededMemory = caerFrameEventPixelFormatBytes(
+			caerFrameEventGetPixelFormat(this), static_cast<size_t>(lenX) * static_cast<size_t>(lenY) * cNumberEnum);
 
 		if (neededMemory > caerFrameEventPacketGetPixelsSize(
 				reinterpret_cast<caerFrameEventPacketConst>(packet.getHeaderPointer()))) {
@@ -237,7 +253,7 @@ struct FrameEvent : public caer_frame_event {
 		}
 
 		// Get pixel value at specified position.
-		return (le16toh(this->pixels[(yAddress * xLength) + xAddress]));
+		return (caerFrameEventGetPixelAtIndexUnsafe(this, static_cast<size_t>((yAddress * xLength) + xAddress)));
 	}
 
 	void setPixel(int32_t xAddress, int32_t yAddress, uint16_t pixelValue) {
@@ -253,7 +269,7 @@ struct FrameEvent : public caer_frame_event {
 		}
 
 		// Set pixel value at specified position.
-		this->pixels[(yAddress * xLength) + xAddress] = htole16(pixelValue);
+		caerFrameEventSetPixelAtIndexUnsafe(this, static_cast<size_t>((yAddress * xLength) + xAddress), pixelValue);
 	}
 
 	uint16_t getPixel(int32_t xAddress, int32_t yAddress, uint8_t channel) const {
@@ -275,7 +291,8 @@ struct FrameEvent : public caer_frame_event {
 		}
 
 		// Get pixel value at specified position.
-		return (le16toh(this->pixels[(((yAddress * xLength) + xAddress) * channelNumber) + channel]));
+		return (caerFrameEventGetPixelAtIndexUnsafe(
+			this, static_cast<size_t>((((yAddress * xLength) + xAddress) * channelNumber) + channel)));
 	}
 
 	void setPixel(int32_t xAddress, int32_t yAddress, uint8_t channel, uint16_t pixelValue) {
@@ -297,31 +314,24 @@ struct FrameEvent : public caer_frame_event {
 		}
 
 		// Set pixel value at specified position.
-		this->pixels[(((yAddress * xLength) + xAddress) * channelNumber) + channel] = htole16(pixelValue);
+		caerFrameEventSetPixelAtIndexUnsafe(
+			this, static_cast<size_t>((((yAddress * xLength) + xAddress) * channelNumber) + channel), pixelValue);
 	}
 
 	uint16_t getPixelUnsafe(int32_t xAddress, int32_t yAddress) const noexcept {
-		// Get pixel value at specified position.
-		return (le16toh(this->pixels[(yAddress * caerFrameEventGetLengthX(this)) + xAddress]));
+		return (caerFrameEventGetPixelUnsafe(this, xAddress, yAddress));
 	}
 
 	void setPixelUnsafe(int32_t xAddress, int32_t yAddress, uint16_t pixelValue) noexcept {
-		// Set pixel value at specified position.
-		this->pixels[(yAddress * caerFrameEventGetLengthX(this)) + xAddress] = htole16(pixelValue);
+		caerFrameEventSetPixelUnsafe(this, xAddress, yAddress, pixelValue);
 	}
 
 	uint16_t getPixelUnsafe(int32_t xAddress, int32_t yAddress, uint8_t channel) const noexcept {
-		uint8_t channelNumber = caerFrameEventGetChannelNumber(this);
-		// Get pixel value at specified position.
-		return (le16toh(
-			this->pixels[(((yAddress * caerFrameEventGetLengthX(this)) + xAddress) * channelNumber) + channel]));
+		return (caerFrameEventGetPixelForChannelUnsafe(this, xAddress, yAddress, channel));
 	}
 
 	void setPixelUnsafe(int32_t xAddress, int32_t yAddress, uint8_t channel, uint16_t pixelValue) noexcept {
-		uint8_t channelNumber = caerFrameEventGetChannelNumber(this);
-		// Set pixel value at specified position.
-		this->pixels[(((yAddress * caerFrameEventGetLengthX(this)) + xAddress) * channelNumber) + channel]
-			= htole16(pixelValue);
+		caerFrameEventSetPixelForChannelUnsafe(this, xAddress, yAddress, channel, pixelValue);
 	}
 
 	uint16_t *getPixelArrayUnsafe() noexcept {
@@ -332,19 +342,36 @@ struct FrameEvent : public caer_frame_event {
 		return (this->pixels);
 	}
 
+	uint8_t *getPixelBytesUnsafe() noexcept {
+		return (caerFrameEventGetPixelBytesUnsafe(this));
+	}
+
+	const uint8_t *getPixelBytesUnsafe() const noexcept {
+		return (caerFrameEventGetPixelBytesUnsafeConst(this));
+	}
+
 #if defined(LIBCAER_FRAMECPP_OPENCV_INSTALLED) && LIBCAER_FRAMECPP_OPENCV_INSTALLED == 1
 
+	// Packed pixel formats have no OpenCV equivalent, an empty Mat is returned for them.
 	cv::Mat getOpenCVMat() noexcept {
+		const int matType = openCVMatType();
+		if (matType < 0) {
+			return (cv::Mat());
+		}
+
 		const cv::Size frameSize(caerFrameEventGetLengthX(this), caerFrameEventGetLengthY(this));
-		cv::Mat frameMat(
-			frameSize, CV_16UC(caerFrameEventGetChannelNumber(this)), reinterpret_cast<void *>(this->pixels));
+		cv::Mat frameMat(frameSize, matType, reinterpret_cast<void *>(this->pixels));
 		return (frameMat);
 	}
 
 	const cv::Mat getOpenCVMat(bool copyPixels = true) const noexcept {
+		const int matType = openCVMatType();
+		if (matType < 0) {
+			return (cv::Mat());
+		}
+
 		const cv::Size frameSize(caerFrameEventGetLengthX(this), caerFrameEventGetLengthY(this));
-		const cv::Mat frameMat(frameSize, CV_16UC(caerFrameEventGetChannelNumber(this)),
-			reinterpret_cast<void *>(const_cast<uint16_t *>(this->pixels)));
+		const cv::Mat frameMat(frameSize, matType, reinterpret_cast<void *>(const_cast<uint16_t *>(this->pixels)));
 
 		if (copyPixels) {
 			return (frameMat.clone());
@@ -354,6 +381,20 @@ struct FrameEvent : public caer_frame_event {
 		}
 	}
 
+private:
+	int openCVMatType() const noexcept {
+		switch (caerFrameEventGetPixelFormat(this)) {
+			case PIXEL_FORMAT_16BIT:
+				return (CV_16UC(caerFrameEventGetChannelNumber(this)));
+
+			case PIXEL_FORMAT_8BIT:
+				return (CV_8UC(caerFrameEventGetChannelNumber(this)));
+
+			default:
+				return (-1);
+		}
+	}
+
 #endif
 };
 
@@ -403,6 +444,27 @@ public:
 		isMemoryOwner = true; // Always owner on new allocation!
 	}
 
+	FrameEventPacket(size_type eventCapacity, int16_t eventSource, int32_t tsOverflow, int32_t maxNumPixels,
+		int16_t maxChannelNumber, FrameEvent::pixelFormat pFormat) {
+		constructorCheckCapacitySourceTSOverflow(eventCapacity, eventSource, tsOverflow);
+
+		if (maxNumPixels <= 0) {
+			throw std::invalid_argument("Negative or zero maximum number of pixels not allowed.");
+		}
+		if (maxChannelNumber <= 0) {
+			throw std::invalid_argument("Negative or zero maximum number of channels not allowed.");
+		}
+
+		caerFrameEventPacket packet = caerFrameEventPacketAllocatePixelFormat(eventCapacity, eventSource, tsOverflow,
+			maxNumPixels, maxChannelNumber,
+			static_cast<enum caer_frame_event_pixel_format>(
+				static_cast<typename std::underlying_type<FrameEvent::pixelFormat>::type>(pFormat)));
+		constructorCheckNullptr(packet);
+
+		header        = &packet->packetHeader;
+		isMemoryOwner = true; // Always owner on new allocation!
+	}
+
 	FrameEventPacket(caerFrameEventPacket packet, bool takeMemoryOwnership = true) {
 		constructorCheckNullptr(packet);
 
@@ -514,6 +576,8 @@ public:
 		OPENCV_HISTOGRAM_EQUALIZATION = 2,
 		OPENCV_CLAHE                  = 3,
 #endif
+		HISTOGRAM_EQUALIZATION = 4,
+		CLAHE                  = 5,
 	};
 
 	void contrast(contrastTypes contrastType) noexcept {
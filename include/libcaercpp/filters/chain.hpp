@@ -0,0 +1,125 @@
+#ifndef LIBCAER_FILTERS_CHAIN_HPP_
+#define LIBCAER_FILTERS_CHAIN_HPP_
+
+#include "../events/polarity.hpp"
+
+#include <libcaer/filters/chain.h>
+
+#include "dvs_noise.hpp"
+#include "dvs_spatial.hpp"
+
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace libcaer {
+namespace filters {
+
+class FilterChain {
+public:
+	using EventCallback = std::function<bool(caerPolarityEvent, caerPolarityEventPacket)>;
+
+private:
+	std::shared_ptr<struct caer_filter_chain> handle;
+	// Keep referenced filters and callbacks alive as long as the chain.
+	std::vector<std::shared_ptr<struct caer_filter_dvs_noise>> noiseFilters;
+	std::vector<std::shared_ptr<struct caer_filter_dvs_spatial>> spatialFilters;
+	std::vector<std::unique_ptr<EventCallback>> callbacks;
+
+	static bool callbackTrampoline(caerPolarityEvent event, caerPolarityEventPacket packet, void *userData) {
+		return ((*static_cast<EventCallback *>(userData))(event, packet));
+	}
+
+	void checkAdd(bool success, const std::string &stageName) const {
+		if (!success) {
+			std::string exc = toString() + ": failed to add " + stageName + " stage.";
+			throw std::runtime_error(exc);
+		}
+	}
+
+public:
+	FilterChain() {
+		caerFilterChain h = caerFilterChainInitialize();
+
+		// Handle constructor failure.
+		if (h == nullptr) {
+			throw std::runtime_error("Failed to initialize filter chain.");
+		}
+
+		// Use stateless lambda for shared_ptr custom deleter.
+		auto deleteDeviceHandle = [](caerFilterChain fh) {
+			// Run destructor, free all memory.
+			// Never fails in current implementation.
+			caerFilterChainDestroy(fh);
+		};
+
+		handle = std::shared_ptr<struct caer_filter_chain>(h, deleteDeviceHandle);
+	}
+
+	~FilterChain() = default;
+
+	// Callbacks are referenced by address from the C chain.
+	FilterChain(const FilterChain &)            = delete;
+	FilterChain &operator=(const FilterChain &) = delete;
+
+	std::string toString() const noexcept {
+		return ("Filter chain");
+	}
+
+	size_t getStagesNumber() const noexcept {
+		return (caerFilterChainGetStagesNumber(handle.get()));
+	}
+
+	uint64_t getStageDropped(size_t stage) const noexcept {
+		return (caerFilterChainGetStageDropped(handle.get(), stage));
+	}
+
+	void addDVSNoise(const DVSNoise &noiseFilter) {
+		checkAdd(caerFilterChainAddDVSNoise(handle.get(), noiseFilter.handle.get()), "DVS noise");
+		noiseFilters.push_back(noiseFilter.handle);
+	}
+
+	void addDVSSpatial(const DVSSpatial &spatialFilter) {
+		checkAdd(caerFilterChainAddDVSSpatial(handle.get(), spatialFilter.handle.get()), "DVS spatial");
+		spatialFilters.push_back(spatialFilter.handle);
+	}
+
+	void addROI(uint16_t startX, uint16_t startY, uint16_t endX, uint16_t endY) {
+		checkAdd(caerFilterChainAddROI(handle.get(), startX, startY, endX, endY), "ROI");
+	}
+
+	void addDecimation(uint32_t factor) {
+		checkAdd(caerFilterChainAddDecimation(handle.get(), factor), "decimation");
+	}
+
+	void addPolaritySelect(bool polarity) {
+		checkAdd(caerFilterChainAddPolaritySelect(handle.get(), polarity), "polarity select");
+	}
+
+	void addCallback(EventCallback callback) {
+		std::unique_ptr<EventCallback> cb(new EventCallback(std::move(callback)));
+
+		checkAdd(caerFilterChainAddCallback(handle.get(), &callbackTrampoline, cb.get()), "callback");
+		callbacks.push_back(std::move(cb));
+	}
+
+	void apply(caerPolarityEventPacket polarity) const noexcept {
+		caerFilterChainApply(handle.get(), polarity);
+	}
+
+	void apply(libcaer::events::PolarityEventPacket &polarity) const noexcept {
+		caerFilterChainApply(handle.get(), (caerPolarityEventPacket) polarity.getHeaderPointer());
+	}
+
+	void apply(libcaer::events::PolarityEventPacket *polarity) const noexcept {
+		if (polarity != nullptr) {
+			caerFilterChainApply(handle.get(), (caerPolarityEventPacket) polarity->getHeaderPointer());
+		}
+	}
+};
+} // namespace filters
+} // namespace libcaer
+
+#endif /* LIBCAER_FILTERS_CHAIN_HPP_ */
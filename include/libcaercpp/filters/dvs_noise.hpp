@@ -12,10 +12,15 @@
 namespace libcaer {
 namespace filters {
 
+class FilterChain;
+
 class DVSNoise {
 private:
 	std::shared_ptr<struct caer_filter_dvs_noise> handle;
 
+	// Filter chain needs the handle to add this as a stage.
+	friend class FilterChain;
+
 public:
 	DVSNoise(uint16_t sizeX, uint16_t sizeY) {
 		caerFilterDVSNoise h = caerFilterDVSNoiseInitialize(sizeX, sizeY);
@@ -88,6 +93,22 @@ public:
 		return (pixels);
 	}
 
+	void stateSave(const std::string &fileName, bool saveTimestamps = true) const {
+		bool success = caerFilterDVSNoiseStateSave(handle.get(), fileName.c_str(), saveTimestamps);
+		if (!success) {
+			std::string exc = toString() + ": failed to save state to file '" + fileName + "'.";
+			throw std::runtime_error(exc);
+		}
+	}
+
+	void stateLoad(const std::string &fileName) const {
+		bool success = caerFilterDVSNoiseStateLoad(handle.get(), fileName.c_str());
+		if (!success) {
+			std::string exc = toString() + ": failed to load state from file '" + fileName + "'.";
+			throw std::runtime_error(exc);
+		}
+	}
+
 	void apply(caerPolarityEventPacket polarity) const noexcept {
 		caerFilterDVSNoiseApply(handle.get(), polarity);
 	}
@@ -0,0 +1,103 @@
+#ifndef LIBCAER_FILTERS_DVS_SPATIAL_HPP_
+#define LIBCAER_FILTERS_DVS_SPATIAL_HPP_
+
+#include "../events/polarity.hpp"
+
+#include <libcaer/filters/dvs_spatial.h>
+
+#include <memory>
+#include <string>
+
+namespace libcaer {
+namespace filters {
+
+class FilterChain;
+
+class DVSSpatial {
+private:
+	std::shared_ptr<struct caer_filter_dvs_spatial> handle;
+
+	// Filter chain needs the handle to add this as a stage.
+	friend class FilterChain;
+
+public:
+	DVSSpatial(uint16_t sizeX, uint16_t sizeY) {
+		caerFilterDVSSpatial h = caerFilterDVSSpatialInitialize(sizeX, sizeY);
+
+		// Handle constructor failure.
+		if (h == nullptr) {
+			std::string exc = "Failed to initialize DVS Spatial filter, sizeX=" + std::to_string(sizeX)
+							  + ", sizeY=" + std::to_string(sizeY) + ".";
+			throw std::runtime_error(exc);
+		}
+
+		// Use stateless lambda for shared_ptr custom deleter.
+		auto deleteDeviceHandle = [](caerFilterDVSSpatial fh) {
+			// Run destructor, free all memory.
+			// Never fails in current implementation.
+			caerFilterDVSSpatialDestroy(fh);
+		};
+
+		handle = std::shared_ptr<struct caer_filter_dvs_spatial>(h, deleteDeviceHandle);
+	}
+
+	~DVSSpatial() = default;
+
+	std::string toString() const noexcept {
+		return ("DVS Spatial filter");
+	}
+
+	void configSet(uint8_t paramAddr, uint64_t param) const {
+		bool success = caerFilterDVSSpatialConfigSet(handle.get(), paramAddr, param);
+		if (!success) {
+			std::string exc = toString() + ": failed to set configuration parameter, paramAddr="
+							  + std::to_string(paramAddr) + ", param=" + std::to_string(param) + ".";
+			throw std::runtime_error(exc);
+		}
+	}
+
+	void configGet(uint8_t paramAddr, uint64_t *param) const {
+		bool success = caerFilterDVSSpatialConfigGet(handle.get(), paramAddr, param);
+		if (!success) {
+			std::string exc
+				= toString() + ": failed to get configuration parameter, paramAddr=" + std::to_string(paramAddr) + ".";
+			throw std::runtime_error(exc);
+		}
+	}
+
+	uint64_t configGet(uint8_t paramAddr) const {
+		uint64_t param = 0;
+		configGet(paramAddr, &param);
+		return (param);
+	}
+
+	void apply(caerPolarityEventPacket polarity) const noexcept {
+		caerFilterDVSSpatialApply(handle.get(), polarity);
+	}
+
+	void apply(libcaer::events::PolarityEventPacket &polarity) const noexcept {
+		caerFilterDVSSpatialApply(handle.get(), (caerPolarityEventPacket) polarity.getHeaderPointer());
+	}
+
+	void apply(libcaer::events::PolarityEventPacket *polarity) const noexcept {
+		if (polarity != nullptr) {
+			caerFilterDVSSpatialApply(handle.get(), (caerPolarityEventPacket) polarity->getHeaderPointer());
+		}
+	}
+
+	std::unique_ptr<libcaer::events::PolarityEventPacket> applyCopy(
+		const libcaer::events::PolarityEventPacket &polarity) const {
+		caerPolarityEventPacket result = caerFilterDVSSpatialApplyCopy(
+			handle.get(), (caerPolarityEventPacketConst) polarity.getHeaderPointer());
+		if (result == nullptr) {
+			return (nullptr);
+		}
+
+		return (std::unique_ptr<libcaer::events::PolarityEventPacket>(
+			new libcaer::events::PolarityEventPacket(result, true)));
+	}
+};
+} // namespace filters
+} // namespace libcaer
+
+#endif /* LIBCAER_FILTERS_DVS_SPATIAL_HPP_ */
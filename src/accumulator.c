@@ -0,0 +1,485 @@
+#include "libcaer/accumulator.h"
+
+#include "parallel_jobs.h"
+
+#include <math.h>
+
+#define ACCUMULATOR_MAX_VOXEL_BINS 16
+// Marks pixels that had no events since the last reset.
+#define ACCUMULATOR_NO_EVENT INT64_MIN
+
+struct caer_accumulator {
+	// Configuration.
+	enum caer_accumulator_types type;
+	bool polarity;
+	uint32_t decay;
+	uint8_t voxelBins;
+	uint32_t voxelBinDuration;
+	uint8_t threads;
+	// Representation: counts or voxel grid bins (one image per bin), and
+	// last event timestamps (for timestamps, time surfaces and decay).
+	float *values;
+	int64_t *timestamps;
+	int64_t firstTimestamp;
+	// Statistics.
+	uint64_t statEvents;
+	// Maximum sizes.
+	uint16_t sizeX;
+	uint16_t sizeY;
+};
+
+struct accumulator_tiles {
+	caerAccumulator accumulator;
+	caerPolarityEventPacketConst polarity;
+	float *buffer;
+	int64_t timestamp;
+	size_t tilesNumber;
+	uint64_t accumulated[PARALLEL_JOBS_MAX_THREADS];
+};
+
+static size_t accumulatorPixels(caerAccumulator accumulator) {
+	return ((size_t) accumulator->sizeX * (size_t) accumulator->sizeY);
+}
+
+static size_t accumulatorPlanes(caerAccumulator accumulator) {
+	return ((accumulator->type == ACCUMULATOR_VOXEL_GRID) ? (accumulator->voxelBins) : (1));
+}
+
+static bool accumulatorAllocate(caerAccumulator accumulator) {
+	float *values
+		= realloc(accumulator->values, accumulatorPixels(accumulator) * accumulatorPlanes(accumulator) * sizeof(float));
+	if (values == NULL) {
+		caerLog(CAER_LOG_ERROR, "Accumulator", "Failed to allocate memory for representation.");
+		return (false);
+	}
+
+	accumulator->values = values;
+
+	caerAccumulatorReset(accumulator);
+
+	return (true);
+}
+
+caerAccumulator caerAccumulatorInitialize(uint16_t sizeX, uint16_t sizeY) {
+	if ((sizeX == 0) || (sizeY == 0)) {
+		return (NULL);
+	}
+
+	caerAccumulator accumulator = calloc(1, sizeof(struct caer_accumulator));
+	if (accumulator == NULL) {
+		return (NULL);
+	}
+
+	accumulator->sizeX = sizeX;
+	accumulator->sizeY = sizeY;
+
+	// Default: plain event count, on one thread.
+	accumulator->type             = ACCUMULATOR_EVENT_COUNT;
+	accumulator->voxelBins        = 5;
+	accumulator->voxelBinDuration = 10000;
+	accumulator->threads          = 1;
+
+	accumulator->timestamps = malloc(accumulatorPixels(accumulator) * sizeof(int64_t));
+	if (accumulator->timestamps == NULL) {
+		free(accumulator);
+		return (NULL);
+	}
+
+	if (!accumulatorAllocate(accumulator)) {
+		free(accumulator->timestamps);
+		free(accumulator);
+		return (NULL);
+	}
+
+	return (accumulator);
+}
+
+void caerAccumulatorDestroy(caerAccumulator accumulator) {
+	free(accumulator->values);
+	free(accumulator->timestamps);
+	free(accumulator);
+}
+
+void caerAccumulatorReset(caerAccumulator accumulator) {
+	size_t pixels = accumulatorPixels(accumulator);
+
+	memset(accumulator->values, 0, pixels * accumulatorPlanes(accumulator) * sizeof(float));
+
+	for (size_t idx = 0; idx < pixels; idx++) {
+		accumulator->timestamps[idx] = ACCUMULATOR_NO_EVENT;
+	}
+
+	accumulator->firstTimestamp = ACCUMULATOR_NO_EVENT;
+	accumulator->statEvents     = 0;
+}
+
+// Decay factor for the time elapsed since a pixel's last event.
+static inline float accumulatorDecay(caerAccumulator accumulator, int64_t timestamp, int64_t lastTimestamp) {
+	return (expf(-(float) (timestamp - lastTimestamp) / (float) accumulator->decay));
+}
+
+// Returns 1 if the event was added, 0 if it falls after the last voxel grid bin.
+static inline uint64_t accumulatorUpdate(
+	caerAccumulator accumulator, size_t idx, int64_t timestamp, bool polarity) {
+	switch (accumulator->type) {
+		case ACCUMULATOR_EVENT_COUNT: {
+			float weight = (!accumulator->polarity || polarity) ? (1.0f) : (-1.0f);
+
+			if ((accumulator->decay != 0) && (accumulator->timestamps[idx] != ACCUMULATOR_NO_EVENT)) {
+				accumulator->values[idx] *= accumulatorDecay(accumulator, timestamp, accumulator->timestamps[idx]);
+			}
+
+			accumulator->values[idx] += weight;
+			accumulator->timestamps[idx] = timestamp;
+			break;
+		}
+
+		case ACCUMULATOR_TIMESTAMP:
+		case ACCUMULATOR_TIME_SURFACE:
+			accumulator->timestamps[idx] = timestamp;
+			break;
+
+		case ACCUMULATOR_VOXEL_GRID: {
+			float weight = (polarity) ? (1.0f) : (-1.0f);
+
+			float position = (float) (timestamp - accumulator->firstTimestamp) / (float) accumulator->voxelBinDuration;
+			size_t bin     = (size_t) position;
+			float fraction = position - (float) bin;
+
+			if (bin >= accumulator->voxelBins) {
+				return (0);
+			}
+
+			size_t pixels = accumulatorPixels(accumulator);
+
+			accumulator->values[(bin * pixels) + idx] += weight * (1.0f - fraction);
+
+			if ((bin + 1) < accumulator->voxelBins) {
+				accumulator->values[((bin + 1) * pixels) + idx] += weight * fraction;
+			}
+			break;
+		}
+	}
+
+	return (1);
+}
+
+// Each tile is a band of rows, going over all events but only updating its
+// own pixels. This keeps the event order per pixel, which decay depends on.
+static void accumulatorAccumulateJob(void *data, size_t tile) {
+	struct accumulator_tiles *tiles = data;
+	caerAccumulator accumulator     = tiles->accumulator;
+
+	uint32_t startY = U32T((accumulator->sizeY * tile) / tiles->tilesNumber);
+	uint32_t endY   = U32T((accumulator->sizeY * (tile + 1)) / tiles->tilesNumber);
+
+	int32_t eventNumber = caerEventPacketHeaderGetEventNumber(&tiles->polarity->packetHeader);
+	uint64_t tsOverflow
+		= U64T(caerEventPacketHeaderGetEventTSOverflow(&tiles->polarity->packetHeader)) << TS_OVERFLOW_SHIFT;
+
+	uint64_t accumulated = 0;
+
+	for (int32_t i = 0; i < eventNumber; i++) {
+		uint32_t eventData = le32toh(tiles->polarity->events[i].data);
+
+		uint32_t x = (eventData >> POLARITY_X_ADDR_SHIFT) & POLARITY_X_ADDR_MASK;
+		uint32_t y = (eventData >> POLARITY_Y_ADDR_SHIFT) & POLARITY_Y_ADDR_MASK;
+
+		if (((eventData & VALID_MARK_MASK) == 0) || (y < startY) || (y >= endY) || (x >= accumulator->sizeX)) {
+			continue;
+		}
+
+		int64_t timestamp = I64T(tsOverflow | le32toh(U32T(tiles->polarity->events[i].timestamp)));
+		bool polarity     = (eventData >> POLARITY_SHIFT) & POLARITY_MASK;
+
+		accumulated += accumulatorUpdate(accumulator, ((size_t) y * accumulator->sizeX) + x, timestamp, polarity);
+	}
+
+	tiles->accumulated[tile] = accumulated;
+}
+
+void caerAccumulatorAccumulate(caerAccumulator accumulator, caerPolarityEventPacketConst polarity) {
+	// Nothing to process.
+	if ((polarity == NULL) || (caerEventPacketHeaderGetEventValid(&polarity->packetHeader) == 0)) {
+		return;
+	}
+
+	// The voxel grid starts at the first event, all tiles need to agree on it.
+	if (accumulator->firstTimestamp == ACCUMULATOR_NO_EVENT) {
+		CAER_POLARITY_CONST_ITERATOR_VALID_START(polarity)
+		accumulator->firstTimestamp = caerPolarityEventGetTimestamp64(caerPolarityIteratorElement, polarity);
+		break;
+		CAER_POLARITY_ITERATOR_VALID_END
+	}
+
+	struct accumulator_tiles tiles = {
+		.accumulator = accumulator,
+		.polarity    = polarity,
+		.tilesNumber = accumulator->threads,
+	};
+
+	parallelJobsRun(&accumulatorAccumulateJob, &tiles, tiles.tilesNumber, tiles.tilesNumber);
+
+	for (size_t tile = 0; tile < tiles.tilesNumber; tile++) {
+		accumulator->statEvents += tiles.accumulated[tile];
+	}
+}
+
+static void accumulatorReadJob(void *data, size_t tile) {
+	struct accumulator_tiles *tiles = data;
+	caerAccumulator accumulator     = tiles->accumulator;
+
+	size_t pixels = accumulatorPixels(accumulator);
+	size_t start  = (pixels * tile) / tiles->tilesNumber;
+	size_t end    = (pixels * (tile + 1)) / tiles->tilesNumber;
+
+	const int64_t *lastTimestamps = accumulator->timestamps;
+	float *buffer                 = tiles->buffer;
+
+	switch (accumulator->type) {
+		case ACCUMULATOR_EVENT_COUNT:
+			for (size_t idx = start; idx < end; idx++) {
+				buffer[idx] = accumulator->values[idx];
+
+				if ((accumulator->decay != 0) && (lastTimestamps[idx] != ACCUMULATOR_NO_EVENT)) {
+					buffer[idx] *= accumulatorDecay(accumulator, tiles->timestamp, lastTimestamps[idx]);
+				}
+			}
+			break;
+
+		case ACCUMULATOR_TIMESTAMP:
+			for (size_t idx = start; idx < end; idx++) {
+				buffer[idx] = (lastTimestamps[idx] == ACCUMULATOR_NO_EVENT)
+								  ? (-1.0f)
+								  : ((float) (tiles->timestamp - lastTimestamps[idx]));
+			}
+			break;
+
+		case ACCUMULATOR_TIME_SURFACE: {
+			float decay = (accumulator->decay == 0) ? (1.0f) : ((float) accumulator->decay);
+
+			for (size_t idx = start; idx < end; idx++) {
+				buffer[idx] = (lastTimestamps[idx] == ACCUMULATOR_NO_EVENT)
+								  ? (0.0f)
+								  : (expf(-(float) (tiles->timestamp - lastTimestamps[idx]) / decay));
+			}
+			break;
+		}
+
+		case ACCUMULATOR_VOXEL_GRID:
+			for (size_t bin = 0; bin < accumulator->voxelBins; bin++) {
+				memcpy(&buffer[(bin * pixels) + start], &accumulator->values[(bin * pixels) + start],
+					(end - start) * sizeof(float));
+			}
+			break;
+	}
+}
+
+void caerAccumulatorGetBuffer(caerAccumulator accumulator, float *buffer, int64_t timestamp) {
+	if (buffer == NULL) {
+		return;
+	}
+
+	struct accumulator_tiles tiles = {
+		.accumulator = accumulator,
+		.buffer      = buffer,
+		.timestamp   = timestamp,
+		.tilesNumber = accumulator->threads,
+	};
+
+	parallelJobsRun(&accumulatorReadJob, &tiles, tiles.tilesNumber, tiles.tilesNumber);
+}
+
+caerFrameEventPacket caerAccumulatorGenerateFrame(caerAccumulator accumulator, int64_t timestamp, int16_t eventSource) {
+	if (timestamp < 0) {
+		return (NULL);
+	}
+
+	size_t valuesNumber = accumulatorPixels(accumulator) * accumulatorPlanes(accumulator);
+	int32_t lengthY     = I32T(accumulator->sizeY * accumulatorPlanes(accumulator));
+
+	float *buffer = malloc(valuesNumber * sizeof(float));
+	if (buffer == NULL) {
+		caerLog(CAER_LOG_ERROR, "Accumulator", "Failed to allocate memory for frame generation.");
+		return (NULL);
+	}
+
+	caerFrameEventPacket framePacket = caerFrameEventPacketAllocate(
+		1, eventSource, I32T(timestamp >> TS_OVERFLOW_SHIFT), accumulator->sizeX, lengthY, GRAYSCALE);
+	if (framePacket == NULL) {
+		free(buffer);
+		caerLog(CAER_LOG_ERROR, "Accumulator", "Failed to allocate frame event packet.");
+		return (NULL);
+	}
+
+	caerAccumulatorGetBuffer(accumulator, buffer, timestamp);
+
+	caerFrameEvent frame = caerFrameEventPacketGetEvent(framePacket, 0);
+	uint16_t *pixels     = caerFrameEventGetPixelArrayUnsafe(frame);
+
+	// Scale of the values to the 16 bit pixel range.
+	float maxValue = 0;
+	for (size_t idx = 0; idx < valuesNumber; idx++) {
+		maxValue = fmaxf(maxValue, fabsf(buffer[idx]));
+	}
+
+	if (accumulator->type == ACCUMULATOR_TIMESTAMP) {
+		// Newest events are brightest, the oldest one is just above no events.
+		float scale = UINT16_MAX / (maxValue + 1.0f);
+
+		for (size_t idx = 0; idx < valuesNumber; idx++) {
+			pixels[idx] = (buffer[idx] < 0) ? (0) : (htole16(U16T(lroundf(UINT16_MAX - (buffer[idx] * scale)))));
+		}
+	}
+	else if (accumulator->type == ACCUMULATOR_TIME_SURFACE) {
+		for (size_t idx = 0; idx < valuesNumber; idx++) {
+			pixels[idx] = htole16(U16T(lroundf(buffer[idx] * UINT16_MAX)));
+		}
+	}
+	else if ((accumulator->type == ACCUMULATOR_VOXEL_GRID) || accumulator->polarity) {
+		// Signed values, zero is the middle of the range.
+		float scale = (maxValue == 0) ? (0) : ((UINT16_MAX / 2) / maxValue);
+
+		for (size_t idx = 0; idx < valuesNumber; idx++) {
+			pixels[idx] = htole16(U16T(lroundf(((UINT16_MAX / 2) + 1) + (buffer[idx] * scale))));
+		}
+	}
+	else {
+		float scale = (maxValue == 0) ? (0) : (UINT16_MAX / maxValue);
+
+		for (size_t idx = 0; idx < valuesNumber; idx++) {
+			pixels[idx] = htole16(U16T(lroundf(buffer[idx] * scale)));
+		}
+	}
+
+	free(buffer);
+
+	// Exposure from the first event to the read-out, within the packet's overflow period.
+	int64_t startTimestamp = accumulator->firstTimestamp;
+	if (startTimestamp == ACCUMULATOR_NO_EVENT) {
+		startTimestamp = timestamp;
+	}
+	else if ((startTimestamp >> TS_OVERFLOW_SHIFT) != (timestamp >> TS_OVERFLOW_SHIFT)) {
+		startTimestamp = timestamp & ~I64T(INT32_MAX);
+	}
+
+	int32_t startTS = I32T(startTimestamp & INT32_MAX);
+	int32_t endTS   = I32T(timestamp & INT32_MAX);
+
+	caerFrameEventSetLengthXLengthYChannelNumber(frame, accumulator->sizeX, lengthY, GRAYSCALE, framePacket);
+	caerFrameEventSetTSStartOfFrame(frame, startTS);
+	caerFrameEventSetTSStartOfExposure(frame, startTS);
+	caerFrameEventSetTSEndOfExposure(frame, endTS);
+	caerFrameEventSetTSEndOfFrame(frame, endTS);
+	caerFrameEventValidate(frame, framePacket);
+
+	return (framePacket);
+}
+
+bool caerAccumulatorConfigSet(caerAccumulator accumulator, uint8_t paramAddr, uint64_t param) {
+	switch (paramAddr) {
+		case CAER_ACCUMULATOR_TYPE: {
+			if (param > ACCUMULATOR_VOXEL_GRID) {
+				return (false);
+			}
+
+			enum caer_accumulator_types oldType = accumulator->type;
+
+			accumulator->type = (enum caer_accumulator_types) param;
+
+			if (!accumulatorAllocate(accumulator)) {
+				accumulator->type = oldType;
+				return (false);
+			}
+			break;
+		}
+
+		case CAER_ACCUMULATOR_POLARITY:
+			accumulator->polarity = param;
+			break;
+
+		case CAER_ACCUMULATOR_DECAY:
+			if (param > UINT32_MAX) {
+				return (false);
+			}
+
+			accumulator->decay = U32T(param);
+			break;
+
+		case CAER_ACCUMULATOR_VOXEL_BINS: {
+			if ((param == 0) || (param > ACCUMULATOR_MAX_VOXEL_BINS)) {
+				return (false);
+			}
+
+			uint8_t oldBins = accumulator->voxelBins;
+
+			accumulator->voxelBins = U8T(param);
+
+			if (!accumulatorAllocate(accumulator)) {
+				accumulator->voxelBins = oldBins;
+				return (false);
+			}
+			break;
+		}
+
+		case CAER_ACCUMULATOR_VOXEL_BIN_DURATION:
+			if ((param == 0) || (param > UINT32_MAX)) {
+				return (false);
+			}
+
+			accumulator->voxelBinDuration = U32T(param);
+			break;
+
+		case CAER_ACCUMULATOR_THREADS:
+			if ((param == 0) || (param > PARALLEL_JOBS_MAX_THREADS) || (param > accumulator->sizeY)) {
+				return (false);
+			}
+
+			accumulator->threads = U8T(param);
+			break;
+
+		default:
+			return (false);
+			break;
+	}
+
+	return (true);
+}
+
+bool caerAccumulatorConfigGet(caerAccumulator accumulator, uint8_t paramAddr, uint64_t *param) {
+	switch (paramAddr) {
+		case CAER_ACCUMULATOR_TYPE:
+			*param = accumulator->type;
+			break;
+
+		case CAER_ACCUMULATOR_POLARITY:
+			*param = accumulator->polarity;
+			break;
+
+		case CAER_ACCUMULATOR_DECAY:
+			*param = accumulator->decay;
+			break;
+
+		case CAER_ACCUMULATOR_VOXEL_BINS:
+			*param = accumulator->voxelBins;
+			break;
+
+		case CAER_ACCUMULATOR_VOXEL_BIN_DURATION:
+			*param = accumulator->voxelBinDuration;
+			break;
+
+		case CAER_ACCUMULATOR_THREADS:
+			*param = accumulator->threads;
+			break;
+
+		case CAER_ACCUMULATOR_STATISTICS:
+			*param = accumulator->statEvents;
+			break;
+
+		default:
+			return (false);
+			break;
+	}
+
+	return (true);
+}
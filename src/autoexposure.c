@@ -3,6 +3,7 @@
 #include "timestamps.h"
 
 #include <math.h>
+#include <stdlib.h>
 
 static inline int32_t upAndClip(int32_t newExposure, int32_t lastExposure) {
 	// Ensure increase.
@@ -32,6 +33,124 @@ static inline int32_t downAndClip(int32_t newExposure, int32_t lastExposure) {
 	return (newExposure);
 }
 
+// Interleaved sub-histograms, so that consecutive pixels with the same value
+// (very common in smooth images) don't serialize on incrementing the same bin.
+struct auto_exposure_histograms {
+	uint32_t pixel[AUTOEXPOSURE_HISTOGRAM_BANKS][AUTOEXPOSURE_HISTOGRAM_PIXELS];
+	uint64_t msv[AUTOEXPOSURE_HISTOGRAM_BANKS][AUTOEXPOSURE_HISTOGRAM_MSV];
+};
+
+static inline void histogramsAdd(
+	struct auto_exposure_histograms *histograms, size_t bank, uint16_t pixelValue, uint32_t weight) {
+	// Constant divisors, compiled to a shift and a multiply respectively.
+	size_t pixelIndex = pixelValue / ((UINT16_MAX + 1) / AUTOEXPOSURE_HISTOGRAM_PIXELS);
+	histograms->pixel[bank][pixelIndex] += weight;
+
+	// UINT16_MAX would fall just past the last MSV region, fold it in.
+	size_t msvIndex = pixelValue / ((UINT16_MAX + 1) / AUTOEXPOSURE_HISTOGRAM_MSV);
+	msvIndex        = (msvIndex >= AUTOEXPOSURE_HISTOGRAM_MSV) ? (AUTOEXPOSURE_HISTOGRAM_MSV - 1) : (msvIndex);
+	histograms->msv[bank][msvIndex] += (uint64_t) pixelValue * weight;
+}
+
+// Add every 'step'th pixel of a row in [start, end) to the histograms. Only
+// pixels on the subsampling grid (multiples of 'step') are taken.
+static void histogramsAddSpan(struct auto_exposure_histograms *histograms, const uint16_t *rowPixels, size_t start,
+	size_t end, size_t step, uint32_t weight) {
+	if (weight == 0) {
+		return;
+	}
+
+	size_t x = ((start + step - 1) / step) * step;
+
+	for (; (x + (3 * step)) < end; x += 4 * step) {
+		uint16_t pixelValue0 = rowPixels[x];
+		uint16_t pixelValue1 = rowPixels[x + step];
+		uint16_t pixelValue2 = rowPixels[x + (2 * step)];
+		uint16_t pixelValue3 = rowPixels[x + (3 * step)];
+
+		histogramsAdd(histograms, 0, pixelValue0, weight);
+		histogramsAdd(histograms, 1, pixelValue1, weight);
+		histogramsAdd(histograms, 2, pixelValue2, weight);
+		histogramsAdd(histograms, 3, pixelValue3, weight);
+	}
+
+	for (; x < end; x += step) {
+		histogramsAdd(histograms, 0, rowPixels[x], weight);
+	}
+}
+
+static inline size_t clipToFrame(int32_t position, int32_t frameSize) {
+	return ((size_t)((position < 0) ? (0) : ((position > frameSize) ? (frameSize) : (position))));
+}
+
+static int32_t predictExposure(autoExposureState state, size_t pixelsSum, uint32_t exposureFrameValue,
+	uint32_t exposureLastSetValue, uint8_t deviceLogLevel, const char *deviceLogString) {
+	(void) deviceLogLevel;
+	(void) deviceLogString;
+
+	// Mean sample value of the frame, as a fraction of the full pixel range.
+	size_t valuesSum = 0;
+
+	for (size_t i = 0; i < AUTOEXPOSURE_HISTOGRAM_MSV; i++) {
+		valuesSum += state->msvHistogram[i];
+	}
+
+	float meanSampleValue   = (float) valuesSum / ((float) pixelsSum * (float) UINT16_MAX);
+	float targetSampleValue = (float) atomic_load_explicit(&state->targetMSV, memory_order_relaxed) / 100.0F;
+
+	// Pixel values are linear in exposure, so the scene irradiance is proportional
+	// to meanSampleValue / exposureFrameValue, and the exposure that hits the target
+	// follows directly. Clipped pixels make over-exposed frames look darker than
+	// they should, and black frames carry no information, so the step is limited;
+	// the following frames refine the estimate.
+	float exposureRatio = (meanSampleValue > 0) ? (targetSampleValue / meanSampleValue)
+												: (AUTOEXPOSURE_PREDICTIVE_MAX_RATIO);
+
+	if (exposureRatio > AUTOEXPOSURE_PREDICTIVE_MAX_RATIO) {
+		exposureRatio = AUTOEXPOSURE_PREDICTIVE_MAX_RATIO;
+	}
+	if (exposureRatio < (1.0F / AUTOEXPOSURE_PREDICTIVE_MAX_RATIO)) {
+		exposureRatio = (1.0F / AUTOEXPOSURE_PREDICTIVE_MAX_RATIO);
+	}
+
+	// With most pixels saturated the mean says nothing about how much too
+	// bright the scene is, so take the biggest allowed step down.
+	float saturatedFrac = (float) state->pixelHistogram[AUTOEXPOSURE_HISTOGRAM_PIXELS - 1] / (float) pixelsSum;
+	if (saturatedFrac > AUTOEXPOSURE_PREDICTIVE_SATURATED) {
+		exposureRatio = (1.0F / AUTOEXPOSURE_PREDICTIVE_MAX_RATIO);
+	}
+
+	float targetExposure = (float) exposureFrameValue * exposureRatio;
+
+	// Damping keeps part of the last set value, 0 jumps straight to the target.
+	float damping = (float) atomic_load_explicit(&state->damping, memory_order_relaxed) / 100.0F;
+
+	float dampedExposure = roundf(targetExposure + (damping * ((float) exposureLastSetValue - targetExposure)));
+	int32_t newExposure  = I32T(dampedExposure);
+
+	// Clip exposure between 1µs and 1s.
+	if (newExposure < 1) {
+		newExposure = 1;
+	}
+	if (newExposure > 1000000) {
+		newExposure = 1000000;
+	}
+
+#if AUTOEXPOSURE_ENABLE_DEBUG_LOGGING == 1
+	commonLog(CAER_LOG_INFO, deviceLogString, deviceLogLevel,
+		"AutoExposure: Mean sample value: %f, target: %f, predicted exposure: %f, new exposure: %" PRIi32 ".",
+		(double) meanSampleValue, (double) targetSampleValue, (double) targetExposure, newExposure);
+#endif
+
+	// Ignore tiny changes, they are within noise and would only cause hunting.
+	int32_t exposureChange = newExposure - I32T(exposureLastSetValue);
+	if (abs(exposureChange) <= I32T(AUTOEXPOSURE_PREDICTIVE_DEADBAND * (float) exposureLastSetValue)) {
+		return (-1);
+	}
+
+	return (newExposure);
+}
+
 int32_t autoExposureCalculate(autoExposureState state, caerFrameEventConst frame, uint32_t exposureFrameValue,
 	uint32_t exposureLastSetValue, uint8_t deviceLogLevel, const char *deviceLogString) {
 	(void) deviceLogLevel;
@@ -44,8 +163,11 @@ int32_t autoExposureCalculate(autoExposureState state, caerFrameEventConst frame
 		exposureFrameValue);
 #endif
 
-	// Only run if the frame corresponds to the last set value.
-	if (exposureFrameValue != exposureLastSetValue) {
+	bool predictive = (atomic_load_explicit(&state->mode, memory_order_relaxed) == APS_AUTOEXPOSURE_PREDICTIVE);
+
+	// Only run if the frame corresponds to the last set value. The predictive
+	// controller works from the frame's actual exposure, so any frame will do.
+	if ((!predictive && (exposureFrameValue != exposureLastSetValue)) || (predictive && (exposureFrameValue == 0))) {
 		return (-1);
 	}
 
@@ -53,27 +175,82 @@ int32_t autoExposureCalculate(autoExposureState state, caerFrameEventConst frame
 	int32_t frameSizeY          = caerFrameEventGetLengthY(frame);
 	const uint16_t *framePixels = caerFrameEventGetPixelArrayUnsafeConst(frame);
 
-	// Reset histograms.
-	memset(state->pixelHistogram, 0, AUTOEXPOSURE_HISTOGRAM_PIXELS * sizeof(size_t));
-	memset(state->msvHistogram, 0, AUTOEXPOSURE_HISTOGRAM_MSV * sizeof(size_t));
+	// Metering configuration.
+	size_t step = atomic_load_explicit(&state->subsample, memory_order_relaxed);
+	if (step == 0) {
+		step = 1;
+	}
+
+	// Metering region in frame coordinates, [start, end).
+	int32_t framePositionX = caerFrameEventGetPositionX(frame);
+	int32_t framePositionY = caerFrameEventGetPositionY(frame);
+
+	size_t roiStartX = clipToFrame(
+		I32T(atomic_load_explicit(&state->roiStartColumn, memory_order_relaxed)) - framePositionX, frameSizeX);
+	size_t roiStartY = clipToFrame(
+		I32T(atomic_load_explicit(&state->roiStartRow, memory_order_relaxed)) - framePositionY, frameSizeY);
+	size_t roiEndX = clipToFrame(
+		I32T(atomic_load_explicit(&state->roiEndColumn, memory_order_relaxed)) + 1 - framePositionX, frameSizeX);
+	size_t roiEndY = clipToFrame(
+		I32T(atomic_load_explicit(&state->roiEndRow, memory_order_relaxed)) + 1 - framePositionY, frameSizeY);
+
+	if (roiEndX < roiStartX) {
+		roiEndX = roiStartX;
+	}
+
+	// Weight 0 means spot metering: only the region counts.
+	uint32_t roiWeight     = atomic_load_explicit(&state->roiWeight, memory_order_relaxed);
+	uint32_t outsideWeight = (roiWeight == 0) ? (0) : (1);
+	uint32_t insideWeight  = (roiWeight == 0) ? (1) : (roiWeight);
 
 	// Fill histograms: 256 regions for pixel values; 5 regions for MSV.
-	for (int32_t y = 0; y < frameSizeY; y++) {
-		for (int32_t x = 0; x < frameSizeX; x++) {
-			uint16_t pixelValue = framePixels[(y * frameSizeX) + x];
+	struct auto_exposure_histograms histograms;
+	memset(&histograms, 0, sizeof(histograms));
+
+	for (size_t y = 0; y < (size_t) frameSizeY; y += step) {
+		const uint16_t *rowPixels = &framePixels[y * (size_t) frameSizeX];
+
+		if ((y >= roiStartY) && (y < roiEndY)) {
+			histogramsAddSpan(&histograms, rowPixels, 0, roiStartX, step, outsideWeight);
+			histogramsAddSpan(&histograms, rowPixels, roiStartX, roiEndX, step, insideWeight);
+			histogramsAddSpan(&histograms, rowPixels, roiEndX, (size_t) frameSizeX, step, outsideWeight);
+		}
+		else {
+			histogramsAddSpan(&histograms, rowPixels, 0, (size_t) frameSizeX, step, outsideWeight);
+		}
+	}
+
+	// Merge sub-histograms. Sum of pixel histogram is equal to the
+	// weighted number of pixels taken into account.
+	size_t pixelsSum = 0;
+
+	for (size_t i = 0; i < AUTOEXPOSURE_HISTOGRAM_PIXELS; i++) {
+		state->pixelHistogram[i] = 0;
 
-			// Update histograms.
-			size_t pixelIndex = pixelValue / ((UINT16_MAX + 1) / AUTOEXPOSURE_HISTOGRAM_PIXELS);
-			state->pixelHistogram[pixelIndex]++;
+		for (size_t bank = 0; bank < AUTOEXPOSURE_HISTOGRAM_BANKS; bank++) {
+			state->pixelHistogram[i] += histograms.pixel[bank][i];
+		}
+
+		pixelsSum += state->pixelHistogram[i];
+	}
+
+	for (size_t i = 0; i < AUTOEXPOSURE_HISTOGRAM_MSV; i++) {
+		state->msvHistogram[i] = 0;
 
-			size_t msvIndex = pixelValue / ((UINT16_MAX + 1) / AUTOEXPOSURE_HISTOGRAM_MSV);
-			state->msvHistogram[msvIndex] += pixelValue;
+		for (size_t bank = 0; bank < AUTOEXPOSURE_HISTOGRAM_BANKS; bank++) {
+			state->msvHistogram[i] += histograms.msv[bank][i];
 		}
 	}
 
-	// Calculate statistics on pixel histogram. Sum of histogram is always equal
-	// to the number of pixels in the camera.
-	size_t pixelsSum = (size_t)(frameSizeX * frameSizeY);
+	// No pixels to meter on (empty metering region with spot metering).
+	if (pixelsSum == 0) {
+		return (-1);
+	}
+
+	if (predictive) {
+		return (predictExposure(
+			state, pixelsSum, exposureFrameValue, exposureLastSetValue, deviceLogLevel, deviceLogString));
+	}
 
 	size_t pixelsBinLow  = (size_t)(AUTOEXPOSURE_LOW_BOUNDARY * (float) AUTOEXPOSURE_HISTOGRAM_PIXELS);
 	size_t pixelsBinHigh = (size_t)(AUTOEXPOSURE_HIGH_BOUNDARY * (float) AUTOEXPOSURE_HISTOGRAM_PIXELS);
@@ -7,6 +7,8 @@
 
 #include "libcaer/devices/davis.h"
 
+#include <stdatomic.h>
+
 #ifdef NDEBUG
 #	define AUTOEXPOSURE_ENABLE_DEBUG_LOGGING 0
 #else
@@ -20,11 +22,25 @@
 #define AUTOEXPOSURE_UNDEROVER_FRAC       0.33f
 #define AUTOEXPOSURE_UNDEROVER_CORRECTION 14000.0f
 #define AUTOEXPOSURE_MSV_CORRECTION       100.0f
+#define AUTOEXPOSURE_HISTOGRAM_BANKS      4
+#define AUTOEXPOSURE_PREDICTIVE_MAX_RATIO 8.0f
+#define AUTOEXPOSURE_PREDICTIVE_DEADBAND  0.02f
+#define AUTOEXPOSURE_PREDICTIVE_SATURATED 0.50f
 
 struct auto_exposure_state {
 	size_t pixelHistogram[AUTOEXPOSURE_HISTOGRAM_PIXELS];
 	size_t msvHistogram[AUTOEXPOSURE_HISTOGRAM_MSV];
 	uint32_t lastFrameExposureValue;
+	// Metering configuration, set from any thread.
+	atomic_uint_fast16_t subsample;
+	atomic_uint_fast16_t roiStartColumn;
+	atomic_uint_fast16_t roiStartRow;
+	atomic_uint_fast16_t roiEndColumn;
+	atomic_uint_fast16_t roiEndRow;
+	atomic_uint_fast8_t roiWeight;
+	atomic_uint_fast8_t mode;
+	atomic_uint_fast8_t targetMSV;
+	atomic_uint_fast8_t damping;
 };
 
 typedef struct auto_exposure_state *autoExposureState;
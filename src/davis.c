@@ -554,6 +554,12 @@ caerEventPacketContainer davisDataGet(caerDeviceHandle cdh) {
 	return (dataExchangeGet(&handle->cHandle.state.dataExchange, &handle->usbState.dataTransfersRun));
 }
 
+void davisDataRecycle(caerDeviceHandle cdh, caerEventPacketContainer container) {
+	davisHandle handle = (davisHandle) cdh;
+
+	davisCommonDataRecycle(&handle->cHandle, container);
+}
+
 static void davisEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSent) {
 	davisHandle handle = (davisHandle) vhd;
 
@@ -58,5 +58,6 @@ bool davisDataStart(caerDeviceHandle handle, void (*dataNotifyIncrease)(void *pt
 	void *dataShutdownUserPtr);
 bool davisDataStop(caerDeviceHandle handle);
 caerEventPacketContainer davisDataGet(caerDeviceHandle handle);
+void davisDataRecycle(caerDeviceHandle handle, caerEventPacketContainer container);
 
 #endif /* LIBCAER_SRC_DAVIS_H_ */
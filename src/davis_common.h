@@ -45,6 +45,7 @@
 #define DAVIS_SPECIAL_DEFAULT_SIZE  128
 #define DAVIS_FRAME_DEFAULT_SIZE    8
 #define DAVIS_IMU_DEFAULT_SIZE      64
+#define DAVIS_FRAME_POOL_SIZE       16
 
 struct davis_common_state {
 	// Per-device log-level
@@ -73,6 +74,8 @@ struct davis_common_state {
 		bool flipY;
 		bool ignoreEvents;
 		bool globalShutter;
+		// Column Start seen, but no Column End yet, see apsCloseColumn().
+		bool columnOpen;
 		uint16_t currentReadoutType;
 		uint16_t countX[APS_READOUT_TYPES_NUM];
 		uint16_t countY[APS_READOUT_TYPES_NUM];
@@ -81,6 +84,18 @@ struct davis_common_state {
 		struct {
 			caerFrameEvent currentEvent;
 			atomic_uint_fast8_t mode;
+			atomic_uint_fast8_t format;
+			// Pixel format of output frames, fixed from data start on.
+			enum caer_frame_event_pixel_format outputFormat;
+			// Demosaic target for color frames that are then converted
+			// to a compact output pixel format, NULL if not needed.
+			caerFrameEventPacket convertPacket;
+			// First readout samples (reset, or signal for DAVIS640H GS),
+			// stored column by column in readout order.
+			uint16_t *firstReadoutSamples;
+			// Second readout samples of the current column, CDS is done
+			// on the whole column at column end.
+			uint16_t *columnSamples;
 #if APS_DEBUG_FRAME == 1
 			uint16_t *resetPixels;
 			uint16_t *signalPixels;
@@ -96,10 +111,6 @@ struct davis_common_state {
 			uint16_t sizeX;
 			uint16_t sizeY;
 		} roi;
-		struct {
-			bool offsetDirection; // 0 is increasing, 1 is decreasing.
-			int16_t offset;
-		} cDavisSupport;
 		struct {
 			uint8_t tmpData;
 			uint32_t currentFrameExposure;
@@ -131,6 +142,9 @@ struct davis_common_state {
 		// Frame Packet state
 		caerFrameEventPacket frame;
 		int32_t framePosition;
+		int32_t frameEventSize;
+		// Frame packets given back by the user for reuse, see davisCommonDataRecycle().
+		caerRingBuffer framePool;
 		// IMU6 Packet state
 		caerIMU6EventPacket imu6;
 		int32_t imu6Position;
@@ -174,6 +188,7 @@ static bool davisCommonConfigGet(davisCommonHandle handle, int8_t modAddr, uint8
 static bool davisCommonDataStart(davisCommonHandle handle, void (*dataNotifyIncrease)(void *ptr),
 	void (*dataNotifyDecrease)(void *ptr), void *dataNotifyUserPtr);
 static void davisCommonDataStop(davisCommonHandle handle);
+static void davisCommonDataRecycle(davisCommonHandle handle, caerEventPacketContainer container);
 static void davisCommonEventTranslator(
 	davisCommonHandle handle, const uint8_t *buffer, size_t bufferSize, atomic_uint_fast32_t *transfersRunning);
 static void davisCommonTSMasterStatusUpdater(void *userDataPtr, int status, uint32_t param);
@@ -219,6 +234,21 @@ static inline void freeAllDataMemory(davisCommonState state) {
 		containerGenerationSetPacket(&state->container, FRAME_EVENT, NULL);
 	}
 
+	if (state->aps.frame.convertPacket != NULL) {
+		free(&state->aps.frame.convertPacket->packetHeader);
+		state->aps.frame.convertPacket = NULL;
+	}
+
+	if (state->currentPackets.framePool != NULL) {
+		caerFrameEventPacket framePacket;
+		while ((framePacket = caerRingBufferGet(state->currentPackets.framePool)) != NULL) {
+			free(&framePacket->packetHeader);
+		}
+
+		caerRingBufferFree(state->currentPackets.framePool);
+		state->currentPackets.framePool = NULL;
+	}
+
 	if (state->currentPackets.imu6 != NULL) {
 		free(&state->currentPackets.imu6->packetHeader);
 		state->currentPackets.imu6 = NULL;
@@ -233,6 +263,16 @@ static inline void freeAllDataMemory(davisCommonState state) {
 		state->aps.frame.currentEvent = NULL;
 	}
 
+	if (state->aps.frame.firstReadoutSamples != NULL) {
+		free(state->aps.frame.firstReadoutSamples);
+		state->aps.frame.firstReadoutSamples = NULL;
+	}
+
+	if (state->aps.frame.columnSamples != NULL) {
+		free(state->aps.frame.columnSamples);
+		state->aps.frame.columnSamples = NULL;
+	}
+
 #if APS_DEBUG_FRAME == 1
 	if (state->aps.frame.resetPixels != NULL) {
 		free(state->aps.frame.resetPixels);
@@ -273,6 +313,7 @@ static inline void apsInitFrame(davisCommonHandle handle) {
 	state->aps.roi.tmpData                       = 0;
 	state->aps.roi.update                        = 0;
 
+	state->aps.columnOpen         = false;
 	state->aps.currentReadoutType = APS_READOUT_RESET;
 	for (size_t i = 0; i < APS_READOUT_TYPES_NUM; i++) {
 		state->aps.countX[i] = 0;
@@ -343,122 +384,182 @@ static inline void apsROIUpdateSizes(davisCommonHandle handle) {
 	}
 }
 
+static inline bool apsIsFirstReadout(davisCommonHandle handle) {
+	davisCommonState state = &handle->state;
+
+	// DAVIS640H GS has inverted samples, signal read comes first.
+	bool isCDavisGS = (IS_DAVIS640H(handle->info.chipID) && state->aps.globalShutter);
+
+	return ((state->aps.currentReadoutType == APS_READOUT_RESET) != isCDavisGS);
+}
+
 static inline void apsUpdateFrame(davisCommonHandle handle, uint16_t data) {
 	davisCommonState state = &handle->state;
 
-	uint16_t xPos = (state->aps.flipX)
-						? (U16T(state->aps.expectedCountX - 1 - state->aps.countX[state->aps.currentReadoutType]))
-						: (state->aps.countX[state->aps.currentReadoutType]);
-	uint16_t yPos = (state->aps.flipY)
-						? (U16T(state->aps.expectedCountY - 1 - state->aps.countY[state->aps.currentReadoutType]))
-						: (state->aps.countY[state->aps.currentReadoutType]);
+	uint16_t countX = state->aps.countX[state->aps.currentReadoutType];
+	uint16_t countY = state->aps.countY[state->aps.currentReadoutType];
 
-	if (IS_DAVIS640H(handle->info.chipID)) {
-		yPos = U16T(yPos + state->aps.cDavisSupport.offset);
+	// Only buffer the samples here, CDS is done per column in apsEndColumn().
+	if (apsIsFirstReadout(handle)) {
+		state->aps.frame.firstReadoutSamples[((size_t) countX * state->aps.expectedCountY) + countY] = data;
+	}
+	else {
+		state->aps.frame.columnSamples[countY] = data;
 	}
+}
 
-	if (state->aps.invertXY) {
-		SWAP_VAR(uint16_t, xPos, yPos);
+/**
+ * Correlated double sampling on a whole column of samples: subtract signal
+ * from reset, clamp to the ADC range and normalize to 16bit generic depth.
+ * Kept free of branches so the compiler can vectorize it.
+ * 'output' may be the same as one of the inputs.
+ */
+static inline void apsCDSColumn(
+	const uint16_t *resetValues, const uint16_t *signalValues, uint16_t *output, size_t length) {
+	for (size_t i = 0; i < length; i++) {
+		int32_t resetValue  = resetValues[i];
+		int32_t signalValue = signalValues[i];
+
+		// Do CDS.
+		int32_t pixelValue = resetValue - signalValue;
+
+		// Check for underflow.
+		pixelValue = (pixelValue < 0) ? (0) : (pixelValue);
+
+		// Check for overflow.
+		pixelValue = (pixelValue > 1023) ? (1023) : (pixelValue);
+
+		// If the signal value is 0, that is only possible if the camera
+		// has seen tons of light. In that case, the photo-diode current
+		// may be greater than the reset current, and the reset value
+		// never goes back up fully, which results in black spots where
+		// there is too much light. This confuses algorithms, so we filter
+		// this out here by setting the pixel to white in that case.
+		// Another effect of the same thing is the reset value not going
+		// back up to a decent value, so we also filter that out here.
+		pixelValue = ((resetValue < 384) | (signalValue == 0)) ? (1023) : (pixelValue);
+
+		// Normalize the ADC value to 16bit generic depth. This depends on ADC used.
+		output[i] = htole16(U16T(pixelValue << (16 - APS_ADC_DEPTH)));
 	}
+}
 
-	size_t pixelPosition = (size_t)(yPos * state->aps.roi.sizeX) + xPos;
+static inline uint16_t apsRowPosition(davisCommonHandle handle, uint16_t countY) {
+	davisCommonState state = &handle->state;
 
-	// Standard CDS support.
-	bool isCDavisGS = (IS_DAVIS640H(handle->info.chipID) && state->aps.globalShutter);
+	uint16_t yPos = (state->aps.flipY) ? (U16T(state->aps.expectedCountY - 1 - countY)) : (countY);
+
+	// DAVIS640H support: first 320 pixels are even, then odd.
+	if (IS_DAVIS640H(handle->info.chipID)) {
+		int32_t offset = (countY < 320) ? (countY + 1) : (318 - (3 * (countY - 320)));
 
-	if (((state->aps.currentReadoutType == APS_READOUT_RESET) && (!isCDavisGS))
-		|| ((state->aps.currentReadoutType == APS_READOUT_SIGNAL) && isCDavisGS)) {
-		state->aps.frame.currentEvent->pixels[pixelPosition] = data;
+		yPos = U16T(yPos + offset);
 	}
-	else {
-		uint16_t resetValue  = 0;
-		uint16_t signalValue = 0;
-
-		if (isCDavisGS) {
-			// DAVIS640H GS has inverted samples, signal read comes first
-			// and was stored above inside state->aps.currentResetFrame.
-			resetValue  = data;
-			signalValue = state->aps.frame.currentEvent->pixels[pixelPosition];
-		}
-		else {
-			resetValue  = state->aps.frame.currentEvent->pixels[pixelPosition];
-			signalValue = data;
-		}
 
-		int32_t pixelValue = 0;
-
-		if ((resetValue < 384) || (signalValue == 0)) {
-			// If the signal value is 0, that is only possible if the camera
-			// has seen tons of light. In that case, the photo-diode current
-			// may be greater than the reset current, and the reset value
-			// never goes back up fully, which results in black spots where
-			// there is too much light. This confuses algorithms, so we filter
-			// this out here by setting the pixel to white in that case.
-			// Another effect of the same thing is the reset value not going
-			// back up to a decent value, so we also filter that out here.
-			pixelValue = 1023;
-		}
-		else {
-			// Do CDS.
-			pixelValue = resetValue - signalValue;
+	return (yPos);
+}
 
-			// Check for underflow.
-			pixelValue = (pixelValue < 0) ? (0) : (pixelValue);
+static inline void apsEndColumn(davisCommonHandle handle) {
+	davisCommonState state = &handle->state;
 
-			// Check for overflow.
-			pixelValue = (pixelValue > 1023) ? (1023) : (pixelValue);
-		}
+	// First readout samples stay buffered until their second readout column.
+	if (apsIsFirstReadout(handle)) {
+		return;
+	}
+
+	uint16_t countX = state->aps.countX[state->aps.currentReadoutType];
+	uint16_t countY = state->aps.countY[state->aps.currentReadoutType];
+
+	// Ignore too big X counts, can happen if column start/end events are lost.
+	if (countX >= state->aps.expectedCountX) {
+		return;
+	}
+
+	uint16_t *firstSamples  = &state->aps.frame.firstReadoutSamples[(size_t) countX * state->aps.expectedCountY];
+	uint16_t *columnSamples = state->aps.frame.columnSamples;
+
+	// Pixel position is columnOffset + (yPos * rowStride). With inverted
+	// X/Y, a readout column is a frame row.
+	uint16_t xPos = (state->aps.flipX) ? (U16T(state->aps.expectedCountX - 1 - countX)) : (countX);
+
+	size_t columnOffset = (state->aps.invertXY) ? ((size_t) xPos * state->aps.roi.sizeX) : (xPos);
+	size_t rowStride    = (state->aps.invertXY) ? (1) : (state->aps.roi.sizeX);
+
+// Separate debug support.
+#if APS_DEBUG_FRAME == 1
+	bool isCDavisGS = (IS_DAVIS640H(handle->info.chipID) && state->aps.globalShutter);
+
+	for (uint16_t y = 0; y < countY; y++) {
+		size_t pixelPosition = columnOffset + ((size_t) apsRowPosition(handle, y) * rowStride);
+
+		uint16_t resetValue  = (isCDavisGS) ? (columnSamples[y]) : (firstSamples[y]);
+		uint16_t signalValue = (isCDavisGS) ? (firstSamples[y]) : (columnSamples[y]);
+
+		// Check for overflow.
+		resetValue  = (resetValue > 1023) ? (1023) : (resetValue);
+		signalValue = (signalValue > 1023) ? (1023) : (signalValue);
 
 		// Normalize the ADC value to 16bit generic depth. This depends on ADC used.
-		pixelValue = pixelValue << (16 - APS_ADC_DEPTH);
+		state->aps.frame.resetPixels[pixelPosition]  = htole16(U16T(resetValue << (16 - APS_ADC_DEPTH)));
+		state->aps.frame.signalPixels[pixelPosition] = htole16(U16T(signalValue << (16 - APS_ADC_DEPTH)));
 
-		state->aps.frame.currentEvent->pixels[pixelPosition] = htole16(U16T(pixelValue));
+		davisLog(CAER_LOG_DEBUG, handle,
+			"APS ADC Sample: column=%" PRIu16 ", row=%" PRIu16 ", index=%zu, reset=%" PRIu16 ", signal=%" PRIu16 ".",
+			countX, y, pixelPosition, resetValue, signalValue);
+	}
+#endif
+
+	if (IS_DAVIS640H(handle->info.chipID) && state->aps.globalShutter) {
+		// DAVIS640H GS has inverted samples, signal read comes first.
+		apsCDSColumn(columnSamples, firstSamples, columnSamples, countY);
+	}
+	else {
+		apsCDSColumn(firstSamples, columnSamples, columnSamples, countY);
 	}
 
-	// DAVIS640H support: first 320 pixels are even, then odd.
 	if (IS_DAVIS640H(handle->info.chipID)) {
-		if (state->aps.cDavisSupport.offsetDirection == 0) { // Increasing
-			state->aps.cDavisSupport.offset++;
+		for (uint16_t y = 0; y < countY; y++) {
+			size_t pixelPosition = columnOffset + ((size_t) apsRowPosition(handle, y) * rowStride);
 
-			if (state->aps.cDavisSupport.offset == 321) {
-				// Switch to decreasing after last even pixel.
-				state->aps.cDavisSupport.offsetDirection = 1;
-				state->aps.cDavisSupport.offset          = 318;
-			}
-		}
-		else { // Decreasing
-			state->aps.cDavisSupport.offset = I16T(state->aps.cDavisSupport.offset - 3);
+			state->aps.frame.currentEvent->pixels[pixelPosition] = columnSamples[y];
 		}
 	}
+	else {
+		// Rows are consecutive, just step through the frame (unsigned wrap-around steps back on flip).
+		size_t step       = (state->aps.flipY) ? (0 - rowStride) : (rowStride);
+		size_t pixelIndex = columnOffset + ((size_t) apsRowPosition(handle, 0) * rowStride);
 
-// Separate debug support.
-#if APS_DEBUG_FRAME == 1
-	// Check for overflow.
-	data = (data > 1023) ? (1023) : (data);
+		for (uint16_t y = 0; y < countY; y++, pixelIndex += step) {
+			state->aps.frame.currentEvent->pixels[pixelIndex] = columnSamples[y];
+		}
+	}
+}
 
-	// Normalize the ADC value to 16bit generic depth. This depends on ADC used.
-	data = U16T(data << (16 - APS_ADC_DEPTH));
+// Pixels are only written out at Column End. If that event is lost, close
+// the open column at the next Column Start or at Frame End, so its pixels
+// are not silently dropped.
+static inline void apsCloseColumn(davisCommonHandle handle) {
+	davisCommonState state = &handle->state;
 
-	// Reset read, put into resetPixels here.
-	if (state->aps.currentReadoutType == APS_READOUT_RESET) {
-		state->aps.frame.resetPixels[pixelPosition] = htole16(data);
+	if (!state->aps.columnOpen) {
+		return;
 	}
 
-	// Signal read, put into pixels here.
-	if (state->aps.currentReadoutType == APS_READOUT_SIGNAL) {
-		state->aps.frame.signalPixels[pixelPosition] = htole16(data);
-	}
+	davisLog(CAER_LOG_ERROR, handle, "APS Column End - %d - %d: missing, closing column with row count %d.",
+		state->aps.currentReadoutType, state->aps.countX[state->aps.currentReadoutType],
+		state->aps.countY[state->aps.currentReadoutType]);
 
-	davisLog(CAER_LOG_DEBUG, handle,
-		"APS ADC Sample: column=%" PRIu16 ", row=%" PRIu16 ", index=%zu, data=%" PRIu16 ".",
-		state->aps.countX[state->aps.currentReadoutType], state->aps.countY[state->aps.currentReadoutType],
-		pixelPosition, data);
-#endif
+	apsEndColumn(handle);
+
+	state->aps.countX[state->aps.currentReadoutType]++;
+	state->aps.columnOpen = false;
 }
 
 static inline bool apsEndFrame(davisCommonHandle handle) {
 	davisCommonState state = &handle->state;
 
+	apsCloseColumn(handle);
+
 	bool validFrame = true;
 
 	for (size_t i = 0; i < APS_READOUT_TYPES_NUM; i++) {
@@ -646,6 +747,18 @@ static bool davisCommonSendDefaultFPGAConfig(davisCommonHandle handle) {
 	davisCommonConfigSet(handle, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_END_ROW_0, U32T(handle->info.apsSizeY - 1));
 	davisCommonConfigSet(handle, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_AUTOEXPOSURE, false);
 	davisCommonConfigSet(handle, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_FRAME_MODE, APS_FRAME_DEFAULT);
+	davisCommonConfigSet(handle, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_AUTOEXPOSURE_SUBSAMPLE, 1);
+	davisCommonConfigSet(handle, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_AUTOEXPOSURE_ROI_START_COLUMN, 0);
+	davisCommonConfigSet(handle, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_AUTOEXPOSURE_ROI_START_ROW, 0);
+	davisCommonConfigSet(
+		handle, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_AUTOEXPOSURE_ROI_END_COLUMN, U32T(handle->info.apsSizeX - 1));
+	davisCommonConfigSet(
+		handle, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_AUTOEXPOSURE_ROI_END_ROW, U32T(handle->info.apsSizeY - 1));
+	davisCommonConfigSet(handle, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_AUTOEXPOSURE_ROI_WEIGHT, 1);
+	davisCommonConfigSet(handle, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_AUTOEXPOSURE_MODE, APS_AUTOEXPOSURE_HEURISTIC);
+	davisCommonConfigSet(handle, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_AUTOEXPOSURE_TARGET_MSV, 50);
+	davisCommonConfigSet(handle, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_AUTOEXPOSURE_DAMPING, 0);
+	davisCommonConfigSet(handle, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_FRAME_FORMAT, PIXEL_FORMAT_16BIT);
 	davisCommonConfigSet(
 		handle, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_EXPOSURE, 4000); // in µs, converted to cycles @ ADCClock later
 	davisCommonConfigSet(handle, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_FRAME_INTERVAL,
@@ -1245,6 +1358,62 @@ static bool davisCommonConfigSet(davisCommonHandle handle, int8_t modAddr, uint8
 					atomic_store(&state->aps.frame.mode, U8T(param));
 					break;
 
+				case DAVIS_CONFIG_APS_AUTOEXPOSURE_SUBSAMPLE:
+					if (param == 0) {
+						return (false);
+					}
+
+					atomic_store(&state->aps.autoExposure.state.subsample, U16T(param));
+					break;
+
+				case DAVIS_CONFIG_APS_AUTOEXPOSURE_ROI_START_COLUMN:
+					atomic_store(&state->aps.autoExposure.state.roiStartColumn, U16T(param));
+					break;
+
+				case DAVIS_CONFIG_APS_AUTOEXPOSURE_ROI_START_ROW:
+					atomic_store(&state->aps.autoExposure.state.roiStartRow, U16T(param));
+					break;
+
+				case DAVIS_CONFIG_APS_AUTOEXPOSURE_ROI_END_COLUMN:
+					atomic_store(&state->aps.autoExposure.state.roiEndColumn, U16T(param));
+					break;
+
+				case DAVIS_CONFIG_APS_AUTOEXPOSURE_ROI_END_ROW:
+					atomic_store(&state->aps.autoExposure.state.roiEndRow, U16T(param));
+					break;
+
+				case DAVIS_CONFIG_APS_AUTOEXPOSURE_ROI_WEIGHT:
+					atomic_store(&state->aps.autoExposure.state.roiWeight, U8T(param));
+					break;
+
+				case DAVIS_CONFIG_APS_AUTOEXPOSURE_MODE:
+					atomic_store(&state->aps.autoExposure.state.mode, U8T(param));
+					break;
+
+				case DAVIS_CONFIG_APS_AUTOEXPOSURE_TARGET_MSV:
+					if ((param == 0) || (param >= 100)) {
+						return (false);
+					}
+
+					atomic_store(&state->aps.autoExposure.state.targetMSV, U8T(param));
+					break;
+
+				case DAVIS_CONFIG_APS_AUTOEXPOSURE_DAMPING:
+					if (param >= 100) {
+						return (false);
+					}
+
+					atomic_store(&state->aps.autoExposure.state.damping, U8T(param));
+					break;
+
+				case DAVIS_CONFIG_APS_FRAME_FORMAT:
+					if (param > PIXEL_FORMAT_10BIT_PACKED) {
+						return (false);
+					}
+
+					atomic_store(&state->aps.frame.format, U8T(param));
+					break;
+
 				default:
 					return (false);
 					break;
@@ -1789,6 +1958,46 @@ static bool davisCommonConfigGet(davisCommonHandle handle, int8_t modAddr, uint8
 					*param = atomic_load(&state->aps.frame.mode);
 					break;
 
+				case DAVIS_CONFIG_APS_AUTOEXPOSURE_SUBSAMPLE:
+					*param = U32T(atomic_load(&state->aps.autoExposure.state.subsample));
+					break;
+
+				case DAVIS_CONFIG_APS_AUTOEXPOSURE_ROI_START_COLUMN:
+					*param = U32T(atomic_load(&state->aps.autoExposure.state.roiStartColumn));
+					break;
+
+				case DAVIS_CONFIG_APS_AUTOEXPOSURE_ROI_START_ROW:
+					*param = U32T(atomic_load(&state->aps.autoExposure.state.roiStartRow));
+					break;
+
+				case DAVIS_CONFIG_APS_AUTOEXPOSURE_ROI_END_COLUMN:
+					*param = U32T(atomic_load(&state->aps.autoExposure.state.roiEndColumn));
+					break;
+
+				case DAVIS_CONFIG_APS_AUTOEXPOSURE_ROI_END_ROW:
+					*param = U32T(atomic_load(&state->aps.autoExposure.state.roiEndRow));
+					break;
+
+				case DAVIS_CONFIG_APS_AUTOEXPOSURE_ROI_WEIGHT:
+					*param = atomic_load(&state->aps.autoExposure.state.roiWeight);
+					break;
+
+				case DAVIS_CONFIG_APS_AUTOEXPOSURE_MODE:
+					*param = atomic_load(&state->aps.autoExposure.state.mode);
+					break;
+
+				case DAVIS_CONFIG_APS_AUTOEXPOSURE_TARGET_MSV:
+					*param = atomic_load(&state->aps.autoExposure.state.targetMSV);
+					break;
+
+				case DAVIS_CONFIG_APS_AUTOEXPOSURE_DAMPING:
+					*param = atomic_load(&state->aps.autoExposure.state.damping);
+					break;
+
+				case DAVIS_CONFIG_APS_FRAME_FORMAT:
+					*param = atomic_load(&state->aps.frame.format);
+					break;
+
 				default:
 					return (false);
 					break;
@@ -2088,6 +2297,12 @@ static bool davisCommonConfigGet(davisCommonHandle handle, int8_t modAddr, uint8
 	return (true);
 }
 
+static caerFrameEventPacket davisCommonFramePacketAllocate(davisCommonHandle handle, int32_t tsOverflow) {
+	return (caerFrameEventPacketAllocatePixelFormat(DAVIS_FRAME_DEFAULT_SIZE, I16T(handle->info.deviceID), tsOverflow,
+		handle->info.apsSizeX * handle->info.apsSizeY, (handle->info.apsColorFilter == MONO) ? (GRAYSCALE) : (RGB),
+		handle->state.aps.frame.outputFormat));
+}
+
 static bool davisCommonDataStart(davisCommonHandle handle, void (*dataNotifyIncrease)(void *ptr),
 	void (*dataNotifyDecrease)(void *ptr), void *dataNotifyUserPtr) {
 	davisCommonState state = &handle->state;
@@ -2128,8 +2343,10 @@ static bool davisCommonDataStart(davisCommonHandle handle, void (*dataNotifyIncr
 		return (false);
 	}
 
-	state->currentPackets.frame = caerFrameEventPacketAllocate(DAVIS_FRAME_DEFAULT_SIZE, I16T(handle->info.deviceID), 0,
-		handle->info.apsSizeX, handle->info.apsSizeY, (handle->info.apsColorFilter == MONO) ? (GRAYSCALE) : (RGB));
+	// Frame packets are sized for the output pixel format, so it can't change while running.
+	state->aps.frame.outputFormat = atomic_load(&state->aps.frame.format);
+
+	state->currentPackets.frame = davisCommonFramePacketAllocate(handle, 0);
 	if (state->currentPackets.frame == NULL) {
 		freeAllDataMemory(state);
 
@@ -2137,6 +2354,28 @@ static bool davisCommonDataStart(davisCommonHandle handle, void (*dataNotifyIncr
 		return (false);
 	}
 
+	state->currentPackets.frameEventSize
+		= caerEventPacketHeaderGetEventSize(&state->currentPackets.frame->packetHeader);
+
+	if ((state->aps.frame.outputFormat != PIXEL_FORMAT_16BIT) && (handle->info.apsColorFilter != MONO)) {
+		state->aps.frame.convertPacket = caerFrameEventPacketAllocate(
+			1, I16T(handle->info.deviceID), 0, handle->info.apsSizeX, handle->info.apsSizeY, RGB);
+		if (state->aps.frame.convertPacket == NULL) {
+			freeAllDataMemory(state);
+
+			davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate frame conversion packet.");
+			return (false);
+		}
+	}
+
+	state->currentPackets.framePool = caerRingBufferInit(DAVIS_FRAME_POOL_SIZE);
+	if (state->currentPackets.framePool == NULL) {
+		freeAllDataMemory(state);
+
+		davisLog(CAER_LOG_CRITICAL, handle, "Failed to initialize frame packet pool.");
+		return (false);
+	}
+
 	state->currentPackets.imu6 = caerIMU6EventPacketAllocate(DAVIS_IMU_DEFAULT_SIZE, I16T(handle->info.deviceID), 0);
 	if (state->currentPackets.imu6 == NULL) {
 		freeAllDataMemory(state);
@@ -2161,6 +2400,25 @@ static bool davisCommonDataStart(davisCommonHandle handle, void (*dataNotifyIncr
 	caerFrameEventSetColorFilter(state->aps.frame.currentEvent, handle->info.apsColorFilter);
 	caerFrameEventSetROIIdentifier(state->aps.frame.currentEvent, 0);
 
+	state->aps.frame.firstReadoutSamples
+		= calloc((size_t) state->aps.sizeX * (size_t) state->aps.sizeY, sizeof(uint16_t));
+	if (state->aps.frame.firstReadoutSamples == NULL) {
+		freeAllDataMemory(state);
+
+		davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate APS first readout samples memory.");
+		return (false);
+	}
+
+	// Columns are rows when X/Y are inverted, so size for the bigger one.
+	state->aps.frame.columnSamples
+		= calloc((state->aps.sizeX > state->aps.sizeY) ? (state->aps.sizeX) : (state->aps.sizeY), sizeof(uint16_t));
+	if (state->aps.frame.columnSamples == NULL) {
+		freeAllDataMemory(state);
+
+		davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate APS column samples memory.");
+		return (false);
+	}
+
 #if APS_DEBUG_FRAME == 1
 	state->aps.frame.resetPixels = calloc((size_t)(state->aps.sizeX * state->aps.sizeY), sizeof(uint16_t));
 	if (state->aps.frame.resetPixels == NULL) {
@@ -2206,62 +2464,121 @@ static void davisCommonDataStop(davisCommonHandle handle) {
 	memset(&state->imu.currentEvent, 0, sizeof(struct caer_imu6_event));
 }
 
-#define TS_WRAP_ADD 0x8000
-
-static void davisCommonEventTranslator(
-	davisCommonHandle handle, const uint8_t *buffer, size_t bufferSize, atomic_uint_fast32_t *transfersRunning) {
+static void davisCommonDataRecycle(davisCommonHandle handle, caerEventPacketContainer container) {
 	davisCommonState state = &handle->state;
 
-	// Truncate off any extra partial event.
-	if ((bufferSize & 0x01) != 0) {
-		davisLog(CAER_LOG_ALERT, handle, "%zu bytes received, which is not a multiple of two.", bufferSize);
-		bufferSize &= ~((size_t) 0x01);
+	if (container == NULL) {
+		return;
 	}
 
-	for (size_t bufferPos = 0; bufferPos < bufferSize; bufferPos += 2) {
-		// Allocate new packets for next iteration as needed.
-		if (!containerGenerationAllocate(&state->container, DAVIS_EVENT_TYPES)) {
-			davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
-			return;
+	// Take frame packets from this device out of the container and put them
+	// into the pool, if there is space. The rest is freed as usual.
+	for (int32_t i = 0; i < caerEventPacketContainerGetEventPacketsNumber(container); i++) {
+		caerEventPacketHeader packet = caerEventPacketContainerGetEventPacket(container, i);
+
+		if ((packet == NULL) || (state->currentPackets.framePool == NULL)
+			|| (caerEventPacketHeaderGetEventType(packet) != FRAME_EVENT)
+			|| (caerEventPacketHeaderGetEventSource(packet) != handle->info.deviceID)
+			|| (caerEventPacketHeaderGetEventSize(packet) != state->currentPackets.frameEventSize)
+			|| caerRingBufferFull(state->currentPackets.framePool)) {
+			continue;
+		}
+
+		caerFrameEventPacket framePacket = (caerFrameEventPacket) packet;
+
+		// Invalidate all frames by clearing their headers. The pixels don't need
+		// clearing, readout overwrites all of them for every frame.
+		for (int32_t j = 0; j < caerEventPacketHeaderGetEventCapacity(packet); j++) {
+			memset(caerFrameEventPacketGetEvent(framePacket, j), 0,
+				sizeof(struct caer_frame_event) - sizeof(uint16_t));
+		}
+
+		caerEventPacketHeaderSetEventNumber(packet, 0);
+		caerEventPacketHeaderSetEventValid(packet, 0);
+
+		if (caerRingBufferPut(state->currentPackets.framePool, framePacket)) {
+			caerEventPacketContainerSetEventPacket(container, i, NULL);
 		}
+	}
+
+	caerEventPacketContainerFree(container);
+}
+
+#define TS_WRAP_ADD 0x8000
 
+// Get the packet container and all current packets ready, preferring recycled
+// frame packets. Only commits take them away, so the event loop can rely on them.
+static bool davisCommonEnsurePackets(davisCommonHandle handle) {
+	davisCommonState state = &handle->state;
+
+	if (!containerGenerationAllocate(&state->container, DAVIS_EVENT_TYPES)) {
+		davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
+		return (false);
+	}
+
+	if (state->currentPackets.special == NULL) {
+		state->currentPackets.special = caerSpecialEventPacketAllocate(
+			DAVIS_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
 		if (state->currentPackets.special == NULL) {
-			state->currentPackets.special = caerSpecialEventPacketAllocate(
-				DAVIS_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.special == NULL) {
-				davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
-				return;
-			}
+			davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
+			return (false);
 		}
+	}
 
+	if (state->currentPackets.polarity == NULL) {
+		state->currentPackets.polarity = caerPolarityEventPacketAllocate(
+			DAVIS_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
 		if (state->currentPackets.polarity == NULL) {
-			state->currentPackets.polarity = caerPolarityEventPacketAllocate(
-				DAVIS_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.polarity == NULL) {
-				davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
-				return;
-			}
+			davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
+			return (false);
+		}
+	}
+
+	if (state->currentPackets.frame == NULL) {
+		// Prefer a recycled packet, avoids allocating and clearing all the pixel memory.
+		state->currentPackets.frame = caerRingBufferGet(state->currentPackets.framePool);
+
+		if (state->currentPackets.frame != NULL) {
+			caerEventPacketHeaderSetEventTSOverflow(
+				&state->currentPackets.frame->packetHeader, state->timestamps.wrapOverflow);
+		}
+		else {
+			state->currentPackets.frame = davisCommonFramePacketAllocate(handle, state->timestamps.wrapOverflow);
 		}
 
 		if (state->currentPackets.frame == NULL) {
-			state->currentPackets.frame = caerFrameEventPacketAllocate(DAVIS_FRAME_DEFAULT_SIZE,
-				I16T(handle->info.deviceID), state->timestamps.wrapOverflow, handle->info.apsSizeX,
-				handle->info.apsSizeY, (handle->info.apsColorFilter == MONO) ? (GRAYSCALE) : (RGB));
-			if (state->currentPackets.frame == NULL) {
-				davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate frame event packet.");
-				return;
-			}
+			davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate frame event packet.");
+			return (false);
 		}
+	}
 
+	if (state->currentPackets.imu6 == NULL) {
+		state->currentPackets.imu6 = caerIMU6EventPacketAllocate(
+			DAVIS_IMU_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
 		if (state->currentPackets.imu6 == NULL) {
-			state->currentPackets.imu6 = caerIMU6EventPacketAllocate(
-				DAVIS_IMU_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.imu6 == NULL) {
-				davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate IMU6 event packet.");
-				return;
-			}
+			davisLog(CAER_LOG_CRITICAL, handle, "Failed to allocate IMU6 event packet.");
+			return (false);
 		}
+	}
+
+	return (true);
+}
+
+static void davisCommonEventTranslator(
+	davisCommonHandle handle, const uint8_t *buffer, size_t bufferSize, atomic_uint_fast32_t *transfersRunning) {
+	davisCommonState state = &handle->state;
 
+	// Truncate off any extra partial event.
+	if ((bufferSize & 0x01) != 0) {
+		davisLog(CAER_LOG_ALERT, handle, "%zu bytes received, which is not a multiple of two.", bufferSize);
+		bufferSize &= ~((size_t) 0x01);
+	}
+
+	if (!davisCommonEnsurePackets(handle)) {
+		return;
+	}
+
+	for (size_t bufferPos = 0; bufferPos < bufferSize; bufferPos += 2) {
 		bool tsReset   = false;
 		bool tsBigWrap = false;
 
@@ -2487,51 +2804,75 @@ static void davisCommonEventTranslator(
 									// Copy header over.
 									memcpy(frameEvent, state->aps.frame.currentEvent,
 										(sizeof(struct caer_frame_event) - sizeof(uint16_t)));
+									caerFrameEventSetPixelFormat(frameEvent, state->aps.frame.outputFormat);
+
+									// 16 bit frame to output, converted to the output pixel format if needed.
+									caerFrameEventConst outputFrame = state->aps.frame.currentEvent;
 
 									if (handle->info.apsColorFilter != MONO) {
 										// Color camera. Frame mode decides what to return.
 										enum caer_davis_aps_frame_modes frameMode
 											= atomic_load_explicit(&state->aps.frame.mode, memory_order_relaxed);
 
-										if (frameMode == APS_FRAME_DEFAULT) {
-											// Default for color sensor means a color image.
-											// Set destination to RGB and do interpolation.
-											caerFrameEventSetLengthXLengthYChannelNumber(frameEvent,
-												state->aps.roi.sizeX, state->aps.roi.sizeY, RGB,
-												state->currentPackets.frame);
+										if (frameMode != APS_FRAME_ORIGINAL) {
+											// Demosaic works on 16 bit pixels: directly into the new
+											// frame if possible, else into the conversion frame.
+											caerFrameEventPacket demosaicPacket = state->currentPackets.frame;
+											caerFrameEvent demosaicEvent        = frameEvent;
+
+											if (state->aps.frame.convertPacket != NULL) {
+												demosaicPacket = state->aps.frame.convertPacket;
+												demosaicEvent  = caerFrameEventPacketGetEvent(demosaicPacket, 0);
+
+												memcpy(demosaicEvent, state->aps.frame.currentEvent,
+													(sizeof(struct caer_frame_event) - sizeof(uint16_t)));
+											}
+
+											if (frameMode == APS_FRAME_DEFAULT) {
+												// Default for color sensor means a color image.
+												// Set destination to RGB and do interpolation.
+												caerFrameEventSetLengthXLengthYChannelNumber(demosaicEvent,
+													state->aps.roi.sizeX, state->aps.roi.sizeY, RGB, demosaicPacket);
 
 #if defined(LIBCAER_HAVE_OPENCV) && LIBCAER_HAVE_OPENCV == 1
-											caerFrameUtilsDemosaic(
-												state->aps.frame.currentEvent, frameEvent, DEMOSAIC_OPENCV_STANDARD);
+												caerFrameUtilsDemosaic(state->aps.frame.currentEvent, demosaicEvent,
+													DEMOSAIC_OPENCV_STANDARD);
 #else
-											caerFrameUtilsDemosaic(
-												state->aps.frame.currentEvent, frameEvent, DEMOSAIC_STANDARD);
+												caerFrameUtilsDemosaic(
+													state->aps.frame.currentEvent, demosaicEvent, DEMOSAIC_STANDARD);
 #endif
-										}
-										else if (frameMode == APS_FRAME_GRAYSCALE) {
+											}
+											else {
 #if defined(LIBCAER_HAVE_OPENCV) && LIBCAER_HAVE_OPENCV == 1
-											caerFrameUtilsDemosaic(
-												state->aps.frame.currentEvent, frameEvent, DEMOSAIC_OPENCV_TO_GRAY);
+												caerFrameUtilsDemosaic(state->aps.frame.currentEvent, demosaicEvent,
+													DEMOSAIC_OPENCV_TO_GRAY);
 #else
-											caerFrameUtilsDemosaic(
-												state->aps.frame.currentEvent, frameEvent, DEMOSAIC_TO_GRAY);
+												caerFrameUtilsDemosaic(
+													state->aps.frame.currentEvent, demosaicEvent, DEMOSAIC_TO_GRAY);
 #endif
-										}
-										else {
-											// APS_FRAME_ORIGINAL, just copy pixels.
-											memcpy(caerFrameEventGetPixelArrayUnsafe(frameEvent),
-												caerFrameEventGetPixelArrayUnsafeConst(state->aps.frame.currentEvent),
-												caerFrameEventGetPixelsSize(state->aps.frame.currentEvent));
+											}
+
+											outputFrame = demosaicEvent;
 										}
 									}
-									else {
-										// Grayscale camera. All modes are equal here
-										// Header is already grayscale and fully setup.
-										// Always copy the pixels over and that's it.
+
+									// Grayscale camera or APS_FRAME_ORIGINAL: header is already
+									// fully setup, just copy the pixels over if they're 16 bit.
+									// Else convert them, from the demosaiced frame for color.
+									if ((outputFrame == state->aps.frame.currentEvent)
+										&& (state->aps.frame.outputFormat == PIXEL_FORMAT_16BIT)) {
 										memcpy(caerFrameEventGetPixelArrayUnsafe(frameEvent),
 											caerFrameEventGetPixelArrayUnsafeConst(state->aps.frame.currentEvent),
 											caerFrameEventGetPixelsSize(state->aps.frame.currentEvent));
 									}
+									else if (outputFrame != frameEvent) {
+										caerFrameEventSetLengthXLengthYChannelNumber(frameEvent,
+											caerFrameEventGetLengthX(outputFrame),
+											caerFrameEventGetLengthY(outputFrame),
+											caerFrameEventGetChannelNumber(outputFrame), state->currentPackets.frame);
+
+										caerFrameUtilsConvertPixelFormat(outputFrame, frameEvent);
+									}
 
 									// Finally, validate new frame.
 									caerFrameEventValidate(frameEvent, state->currentPackets.frame);
@@ -2606,11 +2947,11 @@ static void davisCommonEventTranslator(
 							}
 							davisLog(CAER_LOG_DEBUG, handle, "APS Reset Column Start event received.");
 
+							apsCloseColumn(handle);
+
 							state->aps.currentReadoutType        = APS_READOUT_RESET;
 							state->aps.countY[APS_READOUT_RESET] = 0;
-
-							state->aps.cDavisSupport.offsetDirection = 0;
-							state->aps.cDavisSupport.offset          = 1; // First pixel of row always even.
+							state->aps.columnOpen                = true;
 
 							break;
 						}
@@ -2621,11 +2962,11 @@ static void davisCommonEventTranslator(
 							}
 							davisLog(CAER_LOG_DEBUG, handle, "APS Signal Column Start event received.");
 
+							apsCloseColumn(handle);
+
 							state->aps.currentReadoutType         = APS_READOUT_SIGNAL;
 							state->aps.countY[APS_READOUT_SIGNAL] = 0;
-
-							state->aps.cDavisSupport.offsetDirection = 0;
-							state->aps.cDavisSupport.offset          = 1; // First pixel of row always even.
+							state->aps.columnOpen                 = true;
 
 							break;
 						}
@@ -2648,7 +2989,10 @@ static void davisCommonEventTranslator(
 									state->aps.countY[state->aps.currentReadoutType], state->aps.expectedCountY);
 							}
 
+							apsEndColumn(handle);
+
 							state->aps.countX[state->aps.currentReadoutType]++;
+							state->aps.columnOpen = false;
 
 							break;
 						}
@@ -3223,6 +3567,11 @@ static void davisCommonEventTranslator(
 			containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
 				state->timestamps.current, &state->dataExchange, transfersRunning, handle->info.deviceID,
 				handle->info.deviceString, &state->deviceLogLevel);
+
+			// Committed packets are gone, get new ones for the rest of the buffer.
+			if (!davisCommonEnsurePackets(handle)) {
+				return;
+			}
 		}
 	}
 }
@@ -1,3 +1,6 @@
+// For CPU affinity support (pthread_setaffinity_np(), cpu_set_t).
+#define _GNU_SOURCE 1
+
 #include "davis_rpi.h"
 
 #include <fcntl.h>
@@ -33,12 +36,50 @@
 #define GPIO_AER_DATA0(gpioReg) U8T(gpioReg[13] >> 12)
 #define GPIO_AER_DATA1(gpioReg) U8T(gpioReg[13] >> 20)
 
+// Simulated device: GPIO registers in memory, SPI registers in a table, and
+// a thread playing the StreamTester logic's side of the DDR-AER handshake.
+#define GPIO_MOCK_SPI_MODULES 128
+#define GPIO_MOCK_SPI_PARAMS  256
+
+// StreamTester logic test control, see setupGPIOTest().
+#define GPIO_TEST_MODULE       0x00
+#define GPIO_TEST_PARAM_ENABLE 0x08
+#define GPIO_TEST_PARAM_MODE   0x09
+
+// The simulated GPIO registers are shared with the simulated device thread,
+// so they are atomics, with acquire/release ordering around the handshake.
+#define GPIO_MOCK_SET(mockReg, gpioId) atomic_store_explicit(&(mockReg)[7], U32T(1 << (gpioId)), memory_order_release)
+#define GPIO_MOCK_CLR(mockReg, gpioId) atomic_store_explicit(&(mockReg)[10], U32T(1 << (gpioId)), memory_order_release)
+
+#define GPIO_MOCK_GET(mockReg, gpioId) \
+	(U32T(atomic_load_explicit(&(mockReg)[13], memory_order_acquire)) & U32T(1 << (gpioId)))
+
+#define GPIO_MOCK_AER_DATA0(mockReg) U8T(atomic_load_explicit(&(mockReg)[13], memory_order_acquire) >> 12)
+#define GPIO_MOCK_AER_DATA1(mockReg) U8T(atomic_load_explicit(&(mockReg)[13], memory_order_acquire) >> 20)
+
+struct davis_rpi_gpio_mock {
+	atomic_uint_fast32_t gpioReg[GPIO_REG_LEN / sizeof(uint32_t)];
+	atomic_uint_fast32_t spiRegisters[GPIO_MOCK_SPI_MODULES][GPIO_MOCK_SPI_PARAMS];
+	atomic_uint_fast32_t threadState;
+	thrd_t thread;
+};
+
 static bool initRPi(davisRPiHandle handle);
 static void closeRPi(davisRPiHandle handle);
 
 static bool gpioThreadStart(davisRPiHandle handle);
 static void gpioThreadStop(davisRPiHandle handle);
 static int gpioThreadRun(void *handlePtr);
+static size_t gpioReadTransactions(davisRPiGPIO gpio, uint8_t *data, size_t readTransactions, size_t maxWaitReqCount);
+static size_t gpioMockReadTransactions(
+	davisRPiGPIO gpio, uint8_t *data, size_t readTransactions, size_t maxWaitReqCount);
+static void gpioThreadSetScheduling(davisRPiHandle handle);
+
+static bool gpioMockInit(davisRPiHandle handle);
+static bool gpioMockThreadStart(davisRPiHandle handle);
+static void gpioMockThreadStop(davisRPiHandle handle);
+static int gpioMockThreadRun(void *mockPtr);
+static bool gpioMockSpiTransfer(struct davis_rpi_gpio_mock *mock, const uint8_t *spiOutput, uint8_t *spiInput);
 
 static void davisRPiDataTranslator(davisRPiHandle handle, const uint8_t *buffer, size_t bufferSize);
 
@@ -50,11 +91,9 @@ static bool spiReceive(davisRPiGPIO gpio, uint8_t moduleAddr, uint8_t paramAddr,
 static bool handleChipBiasSend(davisRPiHandle state, uint8_t paramAddr, uint32_t param);
 static bool handleChipBiasReceive(davisRPiHandle state, uint8_t paramAddr, uint32_t *param);
 
-#if DAVIS_RPI_BENCHMARK == 1
 static void davisRPiBenchmarkDataTranslator(davisRPiHandle handle, const uint8_t *buffer, size_t bufferSize);
 static void setupGPIOTest(davisRPiHandle handle, enum benchmarkMode mode);
 static void shutdownGPIOTest(davisRPiHandle handle);
-#endif
 
 ssize_t davisRPiFind(caerDeviceDiscoveryResult *discoveredDevices) {
 	// Set to NULL initially (for error return).
@@ -113,31 +152,38 @@ static bool initRPi(davisRPiHandle handle) {
 	// Ensure global FDs are always uninitialized.
 	gpio->spiFd = -1;
 
-	int devGpioMemFd = open("/dev/gpiomem", O_RDWR | O_SYNC);
-	if (devGpioMemFd < 0) {
-		davisLog(CAER_LOG_CRITICAL, &handle->cHandle, "Failed to open '/dev/gpiomem'.");
-		errno = CAER_ERROR_OPEN_ACCESS;
-		return (false);
+	if (gpio->mock != NULL) {
+		// Simulated device, nothing to open. GPIO registers are accessed
+		// via gpioMockReadTransactions(), gpioReg stays unmapped.
+		gpio->gpioReg = NULL;
 	}
+	else {
+		int devGpioMemFd = open("/dev/gpiomem", O_RDWR | O_SYNC);
+		if (devGpioMemFd < 0) {
+			davisLog(CAER_LOG_CRITICAL, &handle->cHandle, "Failed to open '/dev/gpiomem'.");
+			errno = CAER_ERROR_OPEN_ACCESS;
+			return (false);
+		}
 
-	gpio->gpioReg
-		= mmap(NULL, GPIO_REG_LEN, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_LOCKED, devGpioMemFd, GPIO_REG_BASE);
+		gpio->gpioReg
+			= mmap(NULL, GPIO_REG_LEN, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_LOCKED, devGpioMemFd, GPIO_REG_BASE);
 
-	close(devGpioMemFd);
+		close(devGpioMemFd);
 
-	if (gpio->gpioReg == MAP_FAILED) {
-		davisLog(CAER_LOG_CRITICAL, &handle->cHandle, "Failed to map GPIO memory region.");
-		errno = CAER_ERROR_OPEN_ACCESS;
-		return (false);
-	}
+		if (gpio->gpioReg == MAP_FAILED) {
+			davisLog(CAER_LOG_CRITICAL, &handle->cHandle, "Failed to map GPIO memory region.");
+			errno = CAER_ERROR_OPEN_ACCESS;
+			return (false);
+		}
 
-	// Setup SPI. Upload done by separate tool, at boot.
-	if (!spiInit(gpio)) {
-		closeRPi(handle);
+		// Setup SPI. Upload done by separate tool, at boot.
+		if (!spiInit(gpio)) {
+			closeRPi(handle);
 
-		davisLog(CAER_LOG_CRITICAL, &handle->cHandle, "Failed to initialize SPI.");
-		errno = CAER_ERROR_COMMUNICATION;
-		return (false);
+			davisLog(CAER_LOG_CRITICAL, &handle->cHandle, "Failed to initialize SPI.");
+			errno = CAER_ERROR_COMMUNICATION;
+			return (false);
+		}
 	}
 
 	// Initialize SPI lock last! This avoids having to track its initialization status
@@ -150,12 +196,11 @@ static bool initRPi(davisRPiHandle handle) {
 		return (false);
 	}
 
-#if DAVIS_RPI_BENCHMARK == 0
-	// After CPLD reset, query logic version.
+	// After CPLD reset, query logic version. The StreamTester logic used for benchmarks has its own.
 	uint32_t param = 0;
 	spiConfigReceive(handle->cHandle.spiConfigPtr, DAVIS_CONFIG_SYSINFO, DAVIS_CONFIG_SYSINFO_LOGIC_VERSION, &param);
 
-	if (param < DAVIS_RPI_REQUIRED_LOGIC_REVISION) {
+	if ((!handle->benchmark.enabled) && (param < DAVIS_RPI_REQUIRED_LOGIC_REVISION)) {
 		closeRPi(handle);
 		mtx_destroy(&gpio->spiLock);
 
@@ -167,7 +212,6 @@ static bool initRPi(davisRPiHandle handle) {
 		errno = CAER_ERROR_LOGIC_VERSION;
 		return (false);
 	}
-#endif
 
 	return (true);
 }
@@ -175,6 +219,12 @@ static bool initRPi(davisRPiHandle handle) {
 static void closeRPi(davisRPiHandle handle) {
 	davisRPiGPIO gpio = &handle->gpio;
 
+	if (gpio->mock != NULL) {
+		free(gpio->mock);
+		gpio->mock = NULL;
+		return;
+	}
+
 	// SPI lock mutex destroyed in main exit.
 	spiClose(gpio);
 
@@ -189,7 +239,6 @@ caerDeviceHandle davisRPiOpen(
 	uint16_t deviceID, uint8_t busNumberRestrict, uint8_t devAddressRestrict, const char *serialNumberRestrict) {
 	(void) (busNumberRestrict);
 	(void) (devAddressRestrict);
-	(void) (serialNumberRestrict);
 
 	errno = 0;
 
@@ -218,10 +267,23 @@ caerDeviceHandle davisRPiOpen(
 	// Packet settings (size (in events) and time interval (in µs)).
 	containerGenerationSettingsInit(&state->container);
 
+	// GPIO thread settings.
+	atomic_store(&handle->gpio.threadCpuMask, 0);
+	atomic_store(&handle->gpio.threadPriority, 0);
+	atomic_store(&handle->gpio.batchSize, DAVIS_RPI_MAX_TRANSACTION_NUM);
+	atomic_store(&handle->gpio.maxWaitReqCount, DAVIS_RPI_MAX_WAIT_REQ_COUNT);
+
 	// Logging settings (initialize to global log-level).
 	enum caer_log_level globalLogLevel = caerLogLevelGet();
 	atomic_store(&state->deviceLogLevel, globalLogLevel);
 
+	// Benchmark and simulated device modes are selected via the serial number.
+	bool mock = (serialNumberRestrict != NULL) && (strcmp(serialNumberRestrict, DAVIS_RPI_SERIAL_NUMBER_MOCK) == 0);
+
+	handle->benchmark.enabled
+		= mock
+		  || ((serialNumberRestrict != NULL) && (strcmp(serialNumberRestrict, DAVIS_RPI_SERIAL_NUMBER_BENCHMARK) == 0));
+
 	// Set device string.
 	size_t fullLogStringLength = (size_t) snprintf(NULL, 0, "%s ID-%" PRIu16, DAVIS_RPI_DEVICE_NAME, deviceID);
 
@@ -239,10 +301,21 @@ caerDeviceHandle davisRPiOpen(
 
 	handle->cHandle.info.deviceString = fullLogString;
 
+	if (mock && !gpioMockInit(handle)) {
+		davisLog(CAER_LOG_CRITICAL, &handle->cHandle, "Failed to allocate memory for simulated device.");
+
+		free(handle->cHandle.info.deviceString);
+		free(handle);
+
+		errno = CAER_ERROR_MEMORY_ALLOCATION;
+		return (NULL);
+	}
+
 	// Open the DAVIS device on the Raspberry Pi.
 	if (!initRPi(handle)) {
 		davisLog(CAER_LOG_CRITICAL, &handle->cHandle, "Failed to open device.");
 
+		free(handle->gpio.mock);
 		free(handle->cHandle.info.deviceString);
 		free(handle);
 
@@ -307,6 +380,44 @@ bool davisRPiSendDefaultConfig(caerDeviceHandle cdh) {
 bool davisRPiConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, uint32_t param) {
 	davisRPiHandle handle = (davisRPiHandle) cdh;
 
+	if (modAddr == CAER_HOST_CONFIG_GPIO) {
+		switch (paramAddr) {
+			case CAER_HOST_CONFIG_GPIO_CPU_AFFINITY:
+				atomic_store(&handle->gpio.threadCpuMask, param);
+				break;
+
+			case CAER_HOST_CONFIG_GPIO_REALTIME_PRIORITY:
+				if (param > DAVIS_RPI_MAX_PRIORITY) {
+					return (false);
+				}
+
+				atomic_store(&handle->gpio.threadPriority, param);
+				break;
+
+			case CAER_HOST_CONFIG_GPIO_BATCH_SIZE:
+				if ((param == 0) || (param > DAVIS_RPI_MAX_TRANSACTION_NUM)) {
+					return (false);
+				}
+
+				atomic_store(&handle->gpio.batchSize, param);
+				break;
+
+			case CAER_HOST_CONFIG_GPIO_MAX_WAIT_REQ:
+				if (param == 0) {
+					return (false);
+				}
+
+				atomic_store(&handle->gpio.maxWaitReqCount, param);
+				break;
+
+			default:
+				return (false);
+				break;
+		}
+
+		return (true);
+	}
+
 	if (modAddr == DAVIS_CONFIG_DDRAER) {
 		switch (paramAddr) {
 			case DAVIS_CONFIG_DDRAER_RUN:
@@ -326,6 +437,36 @@ bool davisRPiConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr,
 bool davisRPiConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, uint32_t *param) {
 	davisRPiHandle handle = (davisRPiHandle) cdh;
 
+	if (modAddr == CAER_HOST_CONFIG_GPIO) {
+		switch (paramAddr) {
+			case CAER_HOST_CONFIG_GPIO_CPU_AFFINITY:
+				*param = U32T(atomic_load(&handle->gpio.threadCpuMask));
+				break;
+
+			case CAER_HOST_CONFIG_GPIO_REALTIME_PRIORITY:
+				*param = U32T(atomic_load(&handle->gpio.threadPriority));
+				break;
+
+			case CAER_HOST_CONFIG_GPIO_BATCH_SIZE:
+				*param = U32T(atomic_load(&handle->gpio.batchSize));
+				break;
+
+			case CAER_HOST_CONFIG_GPIO_MAX_WAIT_REQ:
+				*param = U32T(atomic_load(&handle->gpio.maxWaitReqCount));
+				break;
+
+			case CAER_HOST_CONFIG_GPIO_BENCHMARK:
+				*param = handle->benchmark.enabled;
+				break;
+
+			default:
+				return (false);
+				break;
+		}
+
+		return (true);
+	}
+
 	if (modAddr == DAVIS_CONFIG_DDRAER) {
 		switch (paramAddr) {
 			case DAVIS_CONFIG_DDRAER_RUN:
@@ -367,6 +508,41 @@ static void gpioThreadStop(davisRPiHandle handle) {
 	}
 }
 
+static void gpioThreadSetScheduling(davisRPiHandle handle) {
+	uint32_t cpuMask  = U32T(atomic_load(&handle->gpio.threadCpuMask));
+	uint32_t priority = U32T(atomic_load(&handle->gpio.threadPriority));
+
+	// Pin the GPIO thread, so it doesn't migrate away from a warm cache or share a CPU with other work.
+	if (cpuMask != 0) {
+		cpu_set_t cpuSet;
+		CPU_ZERO(&cpuSet);
+
+		for (size_t cpu = 0; cpu < 32; cpu++) {
+			if ((cpuMask & (U32T(1) << cpu)) != 0) {
+				CPU_SET(cpu, &cpuSet);
+			}
+		}
+
+		int result = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpuSet);
+		if (result != 0) {
+			davisLog(CAER_LOG_WARNING, &handle->cHandle,
+				"Failed to set GPIO thread CPU affinity to 0x%" PRIX32 ". Error: %d.", cpuMask, result);
+		}
+	}
+
+	// Real-time scheduling, so the handshake isn't interrupted by other threads.
+	if (priority != 0) {
+		struct sched_param schedParam = {.sched_priority = (int) priority};
+
+		int result = pthread_setschedparam(pthread_self(), SCHED_FIFO, &schedParam);
+		if (result != 0) {
+			davisLog(CAER_LOG_WARNING, &handle->cHandle,
+				"Failed to set GPIO thread real-time priority to %" PRIu32 " (needs CAP_SYS_NICE). Error: %d.",
+				priority, result);
+		}
+	}
+}
+
 static int gpioThreadRun(void *handlePtr) {
 	davisRPiHandle handle = handlePtr;
 	davisRPiGPIO gpio     = &handle->gpio;
@@ -380,6 +556,8 @@ static int gpioThreadRun(void *handlePtr) {
 
 	thrd_set_name(threadName);
 
+	gpioThreadSetScheduling(handle);
+
 	// Allocate data memory. Up to two data points per transaction.
 	uint8_t *data = malloc(DAVIS_RPI_MAX_TRANSACTION_NUM * 2 * sizeof(uint16_t));
 	if (data == NULL) {
@@ -394,61 +572,35 @@ static int gpioThreadRun(void *handlePtr) {
 
 	davisLog(CAER_LOG_DEBUG, &handle->cHandle, "GPIO communication thread running.");
 
-#if DAVIS_RPI_BENCHMARK == 1
-	// Start GPIO testing.
-	spiConfigSend(handle->cHandle.spiConfigPtr, DAVIS_CONFIG_DDRAER, DAVIS_CONFIG_DDRAER_RUN, true);
-	setupGPIOTest(handle, ZEROS);
-#endif
+	if (handle->benchmark.enabled) {
+		// Start GPIO testing.
+		spiConfigSend(handle->cHandle.spiConfigPtr, DAVIS_CONFIG_DDRAER, DAVIS_CONFIG_DDRAER_RUN, true);
+		setupGPIOTest(handle, ZEROS);
+	}
+
+	// Real and simulated GPIO registers need different accesses, pick
+	// the transactions loop once, so the hardware one stays branch-free.
+	size_t (*readTransactionsLoop)(davisRPiGPIO gpio, uint8_t *data, size_t readTransactions, size_t maxWaitReqCount)
+		= (gpio->mock != NULL) ? (&gpioMockReadTransactions) : (&gpioReadTransactions);
 
 	// Handle GPIO port reading.
 	while (atomic_load_explicit(&gpio->threadState, memory_order_relaxed) == THR_RUNNING) {
-		size_t readTransactions = DAVIS_RPI_MAX_TRANSACTION_NUM;
-		size_t dataSize         = 0;
-
-		while (readTransactions-- > 0) {
-			// Do transaction via DDR-AER. Is there a request?
-			size_t noReqCount = 0;
-			while (GPIO_GET(gpio->gpioReg, GPIO_AER_REQ) != 0) {
-				// Track failed wait on requests, and simply break early once
-				// the maximum is reached, to avoid dead-locking in here.
-				noReqCount++;
-				if (noReqCount == DAVIS_RPI_MAX_WAIT_REQ_COUNT) {
-					goto processData;
-				}
-			}
-
-			// Request is present, latch data.
-			data[dataSize++] = GPIO_AER_DATA0(gpio->gpioReg);
-			data[dataSize++] = GPIO_AER_DATA1(gpio->gpioReg);
+		size_t readTransactions = atomic_load_explicit(&gpio->batchSize, memory_order_relaxed);
+		size_t maxWaitReqCount  = atomic_load_explicit(&gpio->maxWaitReqCount, memory_order_relaxed);
 
-			// ACK ACK! (active-low, so clear).
-			GPIO_CLR(gpio->gpioReg, GPIO_AER_ACK);
+		size_t dataSize = (*readTransactionsLoop)(gpio, data, readTransactions, maxWaitReqCount);
 
-			// Wait for REQ to go back off (high).
-			while (GPIO_GET(gpio->gpioReg, GPIO_AER_REQ) == 0) {
-				;
-			}
-
-			// Latch data again.
-			data[dataSize++] = GPIO_AER_DATA0(gpio->gpioReg);
-			data[dataSize++] = GPIO_AER_DATA1(gpio->gpioReg);
-
-			// ACK ACK off! (active-low, so set).
-			GPIO_SET(gpio->gpioReg, GPIO_AER_ACK);
-		}
-
-	// Translate data. Support testing/benchmarking.
-	processData:
+		// Translate data. Support testing/benchmarking.
 		if (dataSize > 0) {
-#if DAVIS_RPI_BENCHMARK == 0
-			davisRPiDataTranslator(handle, data, dataSize);
-#else
-			davisRPiBenchmarkDataTranslator(handle, data, dataSize);
-#endif
+			if (handle->benchmark.enabled) {
+				davisRPiBenchmarkDataTranslator(handle, data, dataSize);
+			}
+			else {
+				davisRPiDataTranslator(handle, data, dataSize);
+			}
 		}
 
-#if DAVIS_RPI_BENCHMARK == 1
-		if (handle->benchmark.dataCount >= DAVIS_RPI_BENCHMARK_LIMIT_BYTES) {
+		if (handle->benchmark.enabled && (handle->benchmark.dataCount >= DAVIS_RPI_BENCHMARK_LIMIT_BYTES)) {
 			shutdownGPIOTest(handle);
 
 			if (handle->benchmark.testMode == ALTERNATING) {
@@ -464,7 +616,6 @@ static int gpioThreadRun(void *handlePtr) {
 
 			setupGPIOTest(handle, handle->benchmark.testMode + 1);
 		}
-#endif
 	}
 
 	free(data);
@@ -477,6 +628,79 @@ static int gpioThreadRun(void *handlePtr) {
 	return (EXIT_SUCCESS);
 }
 
+// Do up to readTransactions transactions via DDR-AER, return the number of data bytes latched.
+static size_t gpioReadTransactions(davisRPiGPIO gpio, uint8_t *data, size_t readTransactions, size_t maxWaitReqCount) {
+	volatile uint32_t *gpioReg = gpio->gpioReg;
+	size_t dataSize            = 0;
+
+	while (readTransactions-- > 0) {
+		// Do transaction via DDR-AER. Is there a request?
+		size_t noReqCount = 0;
+		while (GPIO_GET(gpioReg, GPIO_AER_REQ) != 0) {
+			// Track failed wait on requests, and simply break early once
+			// the maximum is reached, to avoid dead-locking in here.
+			noReqCount++;
+			if (noReqCount == maxWaitReqCount) {
+				return (dataSize);
+			}
+		}
+
+		// Request is present, latch data.
+		data[dataSize++] = GPIO_AER_DATA0(gpioReg);
+		data[dataSize++] = GPIO_AER_DATA1(gpioReg);
+
+		// ACK ACK! (active-low, so clear).
+		GPIO_CLR(gpioReg, GPIO_AER_ACK);
+
+		// Wait for REQ to go back off (high).
+		while (GPIO_GET(gpioReg, GPIO_AER_REQ) == 0) {
+			;
+		}
+
+		// Latch data again.
+		data[dataSize++] = GPIO_AER_DATA0(gpioReg);
+		data[dataSize++] = GPIO_AER_DATA1(gpioReg);
+
+		// ACK ACK off! (active-low, so set).
+		GPIO_SET(gpioReg, GPIO_AER_ACK);
+	}
+
+	return (dataSize);
+}
+
+// Same as gpioReadTransactions(), on the simulated device's atomic registers.
+static size_t gpioMockReadTransactions(
+	davisRPiGPIO gpio, uint8_t *data, size_t readTransactions, size_t maxWaitReqCount) {
+	atomic_uint_fast32_t *mockReg = gpio->mock->gpioReg;
+	size_t dataSize               = 0;
+
+	while (readTransactions-- > 0) {
+		size_t noReqCount = 0;
+		while (GPIO_MOCK_GET(mockReg, GPIO_AER_REQ) != 0) {
+			noReqCount++;
+			if (noReqCount == maxWaitReqCount) {
+				return (dataSize);
+			}
+		}
+
+		data[dataSize++] = GPIO_MOCK_AER_DATA0(mockReg);
+		data[dataSize++] = GPIO_MOCK_AER_DATA1(mockReg);
+
+		GPIO_MOCK_CLR(mockReg, GPIO_AER_ACK);
+
+		while (GPIO_MOCK_GET(mockReg, GPIO_AER_REQ) == 0) {
+			;
+		}
+
+		data[dataSize++] = GPIO_MOCK_AER_DATA0(mockReg);
+		data[dataSize++] = GPIO_MOCK_AER_DATA1(mockReg);
+
+		GPIO_MOCK_SET(mockReg, GPIO_AER_ACK);
+	}
+
+	return (dataSize);
+}
+
 bool davisRPiDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr),
 	void (*dataNotifyDecrease)(void *ptr), void *dataNotifyUserPtr, void (*dataShutdownNotify)(void *ptr),
 	void *dataShutdownUserPtr) {
@@ -490,15 +714,25 @@ bool davisRPiDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *pt
 		return (false);
 	}
 
+	if ((handle->gpio.mock != NULL) && !gpioMockThreadStart(handle)) {
+		freeAllDataMemory(state);
+
+		davisLog(CAER_LOG_CRITICAL, &handle->cHandle, "Failed to start simulated device.");
+		return (false);
+	}
+
 	if (!gpioThreadStart(handle)) {
+		if (handle->gpio.mock != NULL) {
+			gpioMockThreadStop(handle);
+		}
+
 		freeAllDataMemory(state);
 
 		davisLog(CAER_LOG_CRITICAL, &handle->cHandle, "Failed to start GPIO data transfers.");
 		return (false);
 	}
 
-#if DAVIS_RPI_BENCHMARK == 0
-	if (dataExchangeStartProducers(&state->dataExchange)) {
+	if ((!handle->benchmark.enabled) && dataExchangeStartProducers(&state->dataExchange)) {
 		// Enable data transfer on DDR-AER interface.
 		davisRPiConfigSet(cdh, DAVIS_CONFIG_MUX, DAVIS_CONFIG_MUX_RUN_CHIP, true);
 
@@ -521,7 +755,6 @@ bool davisRPiDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *pt
 		davisRPiConfigSet(cdh, DAVIS_CONFIG_IMU, DAVIS_CONFIG_IMU_RUN_TEMPERATURE, true);
 		davisRPiConfigSet(cdh, DAVIS_CONFIG_EXTINPUT, DAVIS_CONFIG_EXTINPUT_RUN_DETECTOR, true);
 	}
-#endif
 
 	return (true);
 }
@@ -530,8 +763,7 @@ bool davisRPiDataStop(caerDeviceHandle cdh) {
 	davisRPiHandle handle  = (davisRPiHandle) cdh;
 	davisCommonState state = &handle->cHandle.state;
 
-#if DAVIS_RPI_BENCHMARK == 0
-	if (dataExchangeStopProducers(&state->dataExchange)) {
+	if ((!handle->benchmark.enabled) && dataExchangeStopProducers(&state->dataExchange)) {
 		// Disable data transfer on DDR-AER interface. Reverse order of enabling.
 		davisRPiConfigSet(cdh, DAVIS_CONFIG_DVS, DAVIS_CONFIG_DVS_RUN, false);
 		davisRPiConfigSet(cdh, DAVIS_CONFIG_APS, DAVIS_CONFIG_APS_RUN, false);
@@ -546,10 +778,13 @@ bool davisRPiDataStop(caerDeviceHandle cdh) {
 
 		davisRPiConfigSet(cdh, DAVIS_CONFIG_MUX, DAVIS_CONFIG_MUX_RUN_CHIP, false);
 	}
-#endif
 
 	gpioThreadStop(handle);
 
+	if (handle->gpio.mock != NULL) {
+		gpioMockThreadStop(handle);
+	}
+
 	davisCommonDataStop(&handle->cHandle);
 
 	return (true);
@@ -561,7 +796,12 @@ caerEventPacketContainer davisRPiDataGet(caerDeviceHandle cdh) {
 	return (dataExchangeGet(&handle->cHandle.state.dataExchange, &handle->gpio.threadState));
 }
 
-#if DAVIS_RPI_BENCHMARK == 1
+void davisRPiDataRecycle(caerDeviceHandle cdh, caerEventPacketContainer container) {
+	davisRPiHandle handle = (davisRPiHandle) cdh;
+
+	davisCommonDataRecycle(&handle->cHandle, container);
+}
+
 static void davisRPiBenchmarkDataTranslator(davisRPiHandle handle, const uint8_t *buffer, size_t bufferSize) {
 	// Return right away if not running anymore. This prevents useless work if many
 	// buffers are still waiting when shut down.
@@ -642,10 +882,10 @@ static void setupGPIOTest(davisRPiHandle handle, enum benchmarkMode mode) {
 	handle->benchmark.testMode = mode;
 
 	// Set test mode.
-	spiConfigSend(handle->cHandle.spiConfigPtr, 0x00, 0x09, mode);
+	spiConfigSend(handle->cHandle.spiConfigPtr, GPIO_TEST_MODULE, GPIO_TEST_PARAM_MODE, mode);
 
 	// Enable test.
-	spiConfigSend(handle->cHandle.spiConfigPtr, 0x00, 0x08, true);
+	spiConfigSend(handle->cHandle.spiConfigPtr, GPIO_TEST_MODULE, GPIO_TEST_PARAM_ENABLE, true);
 
 	// Remember test start time.
 	portable_clock_gettime_monotonic(&handle->benchmark.startTime);
@@ -657,7 +897,7 @@ static void shutdownGPIOTest(davisRPiHandle handle) {
 	portable_clock_gettime_monotonic(&endTime);
 
 	// Disable current tests.
-	spiConfigSend(handle->cHandle.spiConfigPtr, 0x00, 0x08, false);
+	spiConfigSend(handle->cHandle.spiConfigPtr, GPIO_TEST_MODULE, GPIO_TEST_PARAM_ENABLE, false);
 
 	// Drain FIFOs by disabling.
 	spiConfigSend(handle->cHandle.spiConfigPtr, DAVIS_CONFIG_DDRAER, DAVIS_CONFIG_DDRAER_RUN, false);
@@ -686,7 +926,195 @@ static void shutdownGPIOTest(davisRPiHandle handle) {
 	davisLog(CAER_LOG_ERROR, &handle->cHandle, "Test %d: bandwidth of %g bytes/second (%zu bytes in %g seconds).",
 		handle->benchmark.testMode, bytesPerSecond, handle->benchmark.dataCount, diffSecondTime);
 }
-#endif
+
+static bool gpioMockInit(davisRPiHandle handle) {
+	struct davis_rpi_gpio_mock *mock = calloc(1, sizeof(struct davis_rpi_gpio_mock));
+	if (mock == NULL) {
+		return (false);
+	}
+
+	// Idle DDR-AER bus: REQ is active-low.
+	atomic_store(&mock->gpioReg[13], U32T(1 << GPIO_AER_REQ));
+
+	// Present a DAVIS346 master device that passes the logic version check.
+	// All other SPI registers read as zero until written.
+	atomic_store(&mock->spiRegisters[DAVIS_CONFIG_SYSINFO][DAVIS_CONFIG_SYSINFO_LOGIC_VERSION],
+		DAVIS_RPI_REQUIRED_LOGIC_REVISION);
+	atomic_store(&mock->spiRegisters[DAVIS_CONFIG_SYSINFO][DAVIS_CONFIG_SYSINFO_CHIP_IDENTIFIER], DAVIS_CHIP_DAVIS346B);
+	atomic_store(&mock->spiRegisters[DAVIS_CONFIG_SYSINFO][DAVIS_CONFIG_SYSINFO_DEVICE_IS_MASTER], true);
+	atomic_store(&mock->spiRegisters[DAVIS_CONFIG_SYSINFO][DAVIS_CONFIG_SYSINFO_LOGIC_CLOCK], 100);
+	atomic_store(&mock->spiRegisters[DAVIS_CONFIG_SYSINFO][DAVIS_CONFIG_SYSINFO_ADC_CLOCK], 100);
+	atomic_store(&mock->spiRegisters[DAVIS_CONFIG_SYSINFO][DAVIS_CONFIG_SYSINFO_USB_CLOCK], 100);
+	atomic_store(&mock->spiRegisters[DAVIS_CONFIG_SYSINFO][DAVIS_CONFIG_SYSINFO_CLOCK_DEVIATION], 1000);
+	atomic_store(&mock->spiRegisters[DAVIS_CONFIG_DVS][DAVIS_CONFIG_DVS_SIZE_COLUMNS], 346);
+	atomic_store(&mock->spiRegisters[DAVIS_CONFIG_DVS][DAVIS_CONFIG_DVS_SIZE_ROWS], 260);
+	atomic_store(&mock->spiRegisters[DAVIS_CONFIG_APS][DAVIS_CONFIG_APS_SIZE_COLUMNS], 346);
+	atomic_store(&mock->spiRegisters[DAVIS_CONFIG_APS][DAVIS_CONFIG_APS_SIZE_ROWS], 260);
+
+	handle->gpio.mock = mock;
+
+	return (true);
+}
+
+static bool gpioMockThreadStart(davisRPiHandle handle) {
+	struct davis_rpi_gpio_mock *mock = handle->gpio.mock;
+
+	atomic_store(&mock->threadState, THR_IDLE);
+
+	if ((errno = thrd_create(&mock->thread, &gpioMockThreadRun, mock)) != thrd_success) {
+		davisLog(CAER_LOG_CRITICAL, &handle->cHandle, "Failed to create simulated device thread. Error: %d.", errno);
+		return (false);
+	}
+
+	while (atomic_load(&mock->threadState) == THR_IDLE) {
+		thrd_yield();
+	}
+
+	return (true);
+}
+
+static void gpioMockThreadStop(davisRPiHandle handle) {
+	struct davis_rpi_gpio_mock *mock = handle->gpio.mock;
+
+	atomic_store(&mock->threadState, THR_EXITED);
+
+	if ((errno = thrd_join(mock->thread, NULL)) != thrd_success) {
+		// This should never happen!
+		davisLog(CAER_LOG_CRITICAL, &handle->cHandle, "Failed to join simulated device thread. Error: %d.", errno);
+	}
+}
+
+static inline bool gpioMockTestRunning(struct davis_rpi_gpio_mock *mock) {
+	return ((atomic_load_explicit(&mock->threadState, memory_order_relaxed) == THR_RUNNING)
+			&& (atomic_load_explicit(
+					&mock->spiRegisters[GPIO_TEST_MODULE][GPIO_TEST_PARAM_ENABLE], memory_order_relaxed)
+				!= 0)
+			&& (atomic_load_explicit(
+					&mock->spiRegisters[DAVIS_CONFIG_DDRAER][DAVIS_CONFIG_DDRAER_RUN], memory_order_relaxed)
+				!= 0));
+}
+
+// Wait for the host to write ACK to the given SET/CLR register, then consume the write.
+static inline bool gpioMockWaitAck(struct davis_rpi_gpio_mock *mock, size_t ackRegister) {
+	while ((atomic_load_explicit(&mock->gpioReg[ackRegister], memory_order_acquire) & U32T(1 << GPIO_AER_ACK)) == 0) {
+		if (!gpioMockTestRunning(mock)) {
+			return (false);
+		}
+	}
+
+	atomic_store_explicit(&mock->gpioReg[ackRegister], 0, memory_order_relaxed);
+
+	return (true);
+}
+
+static inline uint16_t gpioMockTestFirstValue(enum benchmarkMode mode) {
+	// Same sequences as davisRPiBenchmarkDataTranslator() expects.
+	switch (mode) {
+		case ONES:
+			return (0xFFFF);
+
+		case ALTERNATING:
+			return (0x5555);
+
+		default:
+			return (0);
+	}
+}
+
+static inline uint16_t gpioMockTestNextValue(enum benchmarkMode mode, uint16_t value) {
+	switch (mode) {
+		case ZEROS:
+			return (0);
+
+		case ONES:
+			return (0xFFFF);
+
+		case SWITCHING:
+			return ((value == 0xFFFF) ? (0) : (0xFFFF));
+
+		case ALTERNATING:
+			return ((value == 0x5555) ? (0xAAAA) : (0x5555));
+
+		case COUNTER:
+		default:
+			return (U16T(value + 1));
+	}
+}
+
+static int gpioMockThreadRun(void *mockPtr) {
+	struct davis_rpi_gpio_mock *mock = mockPtr;
+
+	thrd_set_name("DAVISRPiMock");
+
+	atomic_store(&mock->threadState, THR_RUNNING);
+
+	bool testRunning = false;
+	enum benchmarkMode mode = ZEROS;
+	uint16_t value          = 0;
+
+	while (atomic_load_explicit(&mock->threadState, memory_order_relaxed) == THR_RUNNING) {
+		if (!gpioMockTestRunning(mock)) {
+			if (testRunning) {
+				// Test stopped, back to an idle bus.
+				atomic_store_explicit(&mock->gpioReg[13], U32T(1 << GPIO_AER_REQ), memory_order_release);
+				atomic_store_explicit(&mock->gpioReg[7], 0, memory_order_relaxed);
+				atomic_store_explicit(&mock->gpioReg[10], 0, memory_order_relaxed);
+
+				testRunning = false;
+			}
+
+			struct timespec idleSleep = {.tv_sec = 0, .tv_nsec = 100000};
+			thrd_sleep(&idleSleep, NULL);
+			continue;
+		}
+
+		if (!testRunning) {
+			mode = (enum benchmarkMode) atomic_load(&mock->spiRegisters[GPIO_TEST_MODULE][GPIO_TEST_PARAM_MODE]);
+			value = gpioMockTestFirstValue(mode);
+
+			testRunning = true;
+		}
+
+		// DDR-AER: first word with REQ going low, the host ACKs by clearing ACK.
+		atomic_store_explicit(&mock->gpioReg[13], U32T(value) << 12, memory_order_release);
+		value = gpioMockTestNextValue(mode, value);
+
+		if (!gpioMockWaitAck(mock, 10)) {
+			continue;
+		}
+
+		// Second word with REQ going high, the host ACKs by setting ACK.
+		atomic_store_explicit(&mock->gpioReg[13], (U32T(value) << 12) | U32T(1 << GPIO_AER_REQ), memory_order_release);
+		value = gpioMockTestNextValue(mode, value);
+
+		gpioMockWaitAck(mock, 7);
+	}
+
+	return (EXIT_SUCCESS);
+}
+
+static bool gpioMockSpiTransfer(struct davis_rpi_gpio_mock *mock, const uint8_t *spiOutput, uint8_t *spiInput) {
+	uint8_t moduleAddr = spiOutput[0] & 0x7F;
+	uint8_t paramAddr  = spiOutput[1];
+
+	if ((spiOutput[0] & 0x80) == 0) {
+		// Write operation.
+		uint32_t param = (U32T(spiOutput[2]) << 24) | (U32T(spiOutput[3]) << 16) | (U32T(spiOutput[4]) << 8)
+						 | (U32T(spiOutput[5]) << 0);
+
+		atomic_store(&mock->spiRegisters[moduleAddr][paramAddr], param);
+	}
+	else if (spiInput != NULL) {
+		uint32_t param = U32T(atomic_load(&mock->spiRegisters[moduleAddr][paramAddr]));
+
+		spiInput[2] = U8T(param >> 24);
+		spiInput[3] = U8T(param >> 16);
+		spiInput[4] = U8T(param >> 8);
+		spiInput[5] = U8T(param >> 0);
+	}
+
+	return (true);
+}
 
 static void davisRPiDataTranslator(davisRPiHandle handle, const uint8_t *buffer, size_t bufferSize) {
 	// Return right away if not running anymore. This prevents useless work if many
@@ -736,6 +1164,10 @@ static void spiClose(davisRPiGPIO gpio) {
 }
 
 static inline bool spiTransfer(davisRPiGPIO gpio, uint8_t *spiOutput, uint8_t *spiInput) {
+	if (gpio->mock != NULL) {
+		return (gpioMockSpiTransfer(gpio->mock, spiOutput, spiInput));
+	}
+
 	struct spi_ioc_transfer spiTransfer;
 	memset(&spiTransfer, 0, sizeof(struct spi_ioc_transfer));
 
@@ -9,13 +9,13 @@
 
 #define DAVIS_RPI_MAX_TRANSACTION_NUM 4096
 #define DAVIS_RPI_MAX_WAIT_REQ_COUNT  100
+#define DAVIS_RPI_MAX_PRIORITY        99
 
 /**
- * Support benchmarking the GPIO data exchange performance on RPi,
- * using the appropriate StreamTester logic (MachXO3_IoT).
+ * Benchmarking of the GPIO data exchange performance on RPi, using the
+ * appropriate StreamTester logic (MachXO3_IoT), or a simulation of it.
+ * Selected at open, see DAVIS_RPI_SERIAL_NUMBER_BENCHMARK.
  */
-#define DAVIS_RPI_BENCHMARK 0
-
 #define DAVIS_RPI_BENCHMARK_LIMIT_BYTES (8 * 1024 * 1024)
 
 enum benchmarkMode {
@@ -30,12 +30,21 @@ enum benchmarkMode {
 #define DAVIS_BIAS_ADDRESS_MAX 36
 #define DAVIS_CHIP_REG_LENGTH  7
 
+struct davis_rpi_gpio_mock;
+
 struct davis_rpi_gpio {
 	volatile uint32_t *gpioReg;
 	int spiFd;
 	mtx_t spiLock;
 	atomic_uint_fast32_t threadState;
 	thrd_t thread;
+	// GPIO thread settings.
+	atomic_uint_fast32_t threadCpuMask;
+	atomic_uint_fast32_t threadPriority;
+	atomic_uint_fast32_t batchSize;
+	atomic_uint_fast32_t maxWaitReqCount;
+	// Simulated GPIO registers and SPI device, instead of the RPi hardware.
+	struct davis_rpi_gpio_mock *mock;
 	void (*shutdownCallback)(void *shutdownCallbackPtr);
 	void *shutdownCallbackPtr;
 };
@@ -47,15 +56,14 @@ struct davis_rpi_handle {
 	// Data transfer via GPIO for RPi IoT variant.
 	struct davis_rpi_gpio gpio;
 	// Data transfer benchmarking and testing.
-#if DAVIS_RPI_BENCHMARK == 1
 	struct {
+		bool enabled;
 		enum benchmarkMode testMode;
 		uint16_t expectedValue;
 		size_t dataCount;
 		size_t errorCount;
 		struct timespec startTime;
 	} benchmark;
-#endif
 	// Bias/chip config register control.
 	struct {
 		uint8_t currentBiasArray[DAVIS_BIAS_ADDRESS_MAX + 1][2];
@@ -67,7 +75,8 @@ typedef struct davis_rpi_handle *davisRPiHandle;
 
 ssize_t davisRPiFind(caerDeviceDiscoveryResult *discoveredDevices);
 
-// busNumberRestrict, devAddressRestrict and serialNumberRestrict are ignored, only one device connected.
+// busNumberRestrict and devAddressRestrict are ignored, only one device connected.
+// serialNumberRestrict only selects benchmark or simulated (mock) modes.
 caerDeviceHandle davisRPiOpen(
 	uint16_t deviceID, uint8_t busNumberRestrict, uint8_t devAddressRestrict, const char *serialNumberRestrict);
 bool davisRPiClose(caerDeviceHandle cdh);
@@ -83,5 +92,6 @@ bool davisRPiDataStart(caerDeviceHandle handle, void (*dataNotifyIncrease)(void
 	void *dataShutdownUserPtr);
 bool davisRPiDataStop(caerDeviceHandle handle);
 caerEventPacketContainer davisRPiDataGet(caerDeviceHandle handle);
+void davisRPiDataRecycle(caerDeviceHandle handle, caerEventPacketContainer container);
 
 #endif /* LIBCAER_SRC_DAVIS_RPI_H_ */
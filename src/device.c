@@ -207,6 +207,25 @@ static caerEventPacketContainer (*dataGetters[CAER_SUPPORTED_DEVICES_NUMBER])(ca
 	[CAER_DEVICE_SAMSUNG_EVK] = &samsungEVKDataGet,
 };
 
+static void (*dataRecyclers[CAER_SUPPORTED_DEVICES_NUMBER])(
+	caerDeviceHandle handle, caerEventPacketContainer container)
+	= {
+		[CAER_DEVICE_DVS128]    = NULL,
+		[CAER_DEVICE_DAVIS_FX2] = &davisDataRecycle,
+		[CAER_DEVICE_DAVIS_FX3] = &davisDataRecycle,
+		[CAER_DEVICE_DYNAPSE]   = NULL,
+		[CAER_DEVICE_DAVIS]     = &davisDataRecycle,
+		[CAER_DEVICE_EDVS]      = NULL,
+#if defined(OS_LINUX)
+		[CAER_DEVICE_DAVIS_RPI] = &davisRPiDataRecycle,
+#else
+		[CAER_DEVICE_DAVIS_RPI] = NULL,
+#endif
+		[CAER_DEVICE_DVS132S]     = NULL,
+		[CAER_DEVICE_DVXPLORER]   = NULL,
+		[CAER_DEVICE_SAMSUNG_EVK] = NULL,
+};
+
 // Add empty InfoGet for optional devices, such as serial ones.
 #if defined(LIBCAER_HAVE_SERIALDEV) && LIBCAER_HAVE_SERIALDEV == 0
 struct caer_edvs_info caerEDVSInfoGet(caerDeviceHandle handle) {
@@ -404,6 +423,17 @@ caerEventPacketContainer caerDeviceDataGet(caerDeviceHandle handle) {
 	return (dataGetters[handle->deviceType](handle));
 }
 
+void caerDeviceDataRecycle(caerDeviceHandle handle, caerEventPacketContainer container) {
+	// Devices without packet reuse, or invalid handles, just free the container.
+	if ((handle == NULL) || (handle->deviceType >= CAER_SUPPORTED_DEVICES_NUMBER)
+		|| (dataRecyclers[handle->deviceType] == NULL)) {
+		caerEventPacketContainerFree(container);
+		return;
+	}
+
+	dataRecyclers[handle->deviceType](handle, container);
+}
+
 bool caerDeviceConfigGet64(caerDeviceHandle handle, int8_t modAddr, uint8_t paramAddr, uint64_t *param) {
 	// Ensure param is zeroed out.
 	*param = 0;
@@ -1083,6 +1083,156 @@ static inline bool ensureSpaceForEvents(
 	return (true);
 }
 
+// Present pixels of each 4-pixel group presence mask, in host-packet-order:
+// 0 is top left, 1 top right, 2 bottom left, 3 bottom right.
+static const uint8_t groupPixelsNumber[16] = {0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4};
+static const uint8_t groupPixels[16][4]    = {{0}, {0}, {1}, {0, 1}, {2}, {0, 2}, {1, 2}, {0, 1, 2}, {3}, {0, 3},
+	{1, 3}, {0, 1, 3}, {2, 3}, {0, 2, 3}, {1, 2, 3}, {0, 1, 2, 3}};
+
+// Decode a run of consecutive DVS address events (Y address, X address and
+// 4-pixel group), starting with the group event at bufferPos. They don't
+// change the timestamp, nor any other packet, so the per-event allocation
+// and commit checks of the main loop are not needed for them.
+// Stops before any other event, at the end of the buffer, or when the
+// polarity packet reaches the commit size, so the main loop can commit.
+// Returns the position of the last decoded event.
+static size_t dvsDecodeRun(dvs132sHandle handle, const uint8_t *buffer, size_t bufferPos, size_t bufferSize) {
+	dvs132sState state = &handle->state;
+
+	int32_t commitSize = containerGenerationGetMaxPacketSize(&state->container);
+	int32_t timestamp  = I32T(htole32(U32T(state->timestamps.current)));
+
+	// Address increments of the pixels inside a group, added to the group address.
+	uint32_t shiftX             = (state->dvs.invertXY) ? (POLARITY_Y_ADDR_SHIFT) : (POLARITY_X_ADDR_SHIFT);
+	uint32_t shiftY             = (state->dvs.invertXY) ? (POLARITY_X_ADDR_SHIFT) : (POLARITY_Y_ADDR_SHIFT);
+	const uint32_t pixelData[4] = {0, U32T(1) << shiftX, U32T(1) << shiftY, (U32T(1) << shiftX) | (U32T(1) << shiftY)};
+
+	// Free space in the polarity packet, only looked up again when exhausted.
+	int32_t space = caerEventPacketHeaderGetEventCapacity(&state->currentPackets.polarity->packetHeader)
+					- state->currentPackets.polarityPosition;
+
+	for (; bufferPos < bufferSize; bufferPos += 2) {
+		uint16_t event = le16toh(*((const uint16_t *) (&buffer[bufferPos])));
+		uint16_t data  = (event & 0x0FFF);
+
+		switch (event & 0xF000) {
+			case 0x1000: // Y group address
+				// Check range conformity.
+				if (data >= state->dvs.sizeY) {
+					dvs132sLog(CAER_LOG_ALERT, handle,
+						"DVS: Y address out of range (0-%d): %" PRIu16 ", due to USB communication issue.",
+						state->dvs.sizeY - 1, data);
+					break; // Skip invalid Y address (don't update lastY).
+				}
+
+				state->dvs.lastY = data;
+				break;
+
+			case 0x2000: // X group address
+				// Check range conformity.
+				if (data >= state->dvs.sizeX) {
+					dvs132sLog(CAER_LOG_ALERT, handle,
+						"DVS: X address out of range (0-%d): %" PRIu16 ", due to USB communication issue.",
+						state->dvs.sizeX - 1, data);
+					break; // Skip invalid X address (don't update lastX).
+				}
+
+				state->dvs.lastX = data;
+				break;
+
+			case 0x3000: { // 4-pixel group event presence and polarity.
+				if (space < 4) {
+					if (!ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.polarity,
+							(size_t) state->currentPackets.polarityPosition, 4, handle)) {
+						break;
+					}
+
+					space = caerEventPacketHeaderGetEventCapacity(&state->currentPackets.polarity->packetHeader)
+							- state->currentPackets.polarityPosition;
+				}
+
+				uint8_t presence   = U8T((data >> 4) & 0x0F);
+				int32_t number     = groupPixelsNumber[presence];
+				const uint8_t *pix = groupPixels[presence];
+
+				uint32_t baseData = (U32T(1) << VALID_MARK_SHIFT) | (U32T(state->dvs.lastX) << shiftX)
+									| (U32T(state->dvs.lastY) << shiftY);
+
+				caerPolarityEvent events = caerPolarityEventPacketGetEvent(
+					state->currentPackets.polarity, state->currentPackets.polarityPosition);
+
+				// Timestamp at event-stream insertion point, polarity bits in pixel order.
+				for (int32_t i = 0; i < number; i++) {
+					events[i].data = htole32(
+						(baseData + pixelData[pix[i]]) | (U32T((data >> pix[i]) & 0x01) << POLARITY_SHIFT));
+					events[i].timestamp = timestamp;
+				}
+
+				caerEventPacketHeader polarityHeader = &state->currentPackets.polarity->packetHeader;
+				caerEventPacketHeaderSetEventNumber(
+					polarityHeader, caerEventPacketHeaderGetEventNumber(polarityHeader) + number);
+				caerEventPacketHeaderSetEventValid(
+					polarityHeader, caerEventPacketHeaderGetEventValid(polarityHeader) + number);
+
+				state->currentPackets.polarityPosition += number;
+				space -= number;
+
+				if ((commitSize > 0) && (state->currentPackets.polarityPosition >= commitSize)) {
+					return (bufferPos);
+				}
+
+				break;
+			}
+
+			default:
+				// Not a DVS address event, leave it to the main loop.
+				return (bufferPos - 2);
+		}
+	}
+
+	return (bufferPos - 2);
+}
+
+// Make sure the packet container and all current packets exist, so the event
+// loop does not need to check for them. They are only taken away on commit.
+static bool dvs132sEnsurePackets(dvs132sHandle handle) {
+	dvs132sState state = &handle->state;
+
+	if (!containerGenerationAllocate(&state->container, DVS132S_EVENT_TYPES)) {
+		dvs132sLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
+		return (false);
+	}
+
+	if (state->currentPackets.special == NULL) {
+		state->currentPackets.special = caerSpecialEventPacketAllocate(
+			DVS132S_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+		if (state->currentPackets.special == NULL) {
+			dvs132sLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
+			return (false);
+		}
+	}
+
+	if (state->currentPackets.polarity == NULL) {
+		state->currentPackets.polarity = caerPolarityEventPacketAllocate(
+			DVS132S_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+		if (state->currentPackets.polarity == NULL) {
+			dvs132sLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
+			return (false);
+		}
+	}
+
+	if (state->currentPackets.imu6 == NULL) {
+		state->currentPackets.imu6 = caerIMU6EventPacketAllocate(
+			DVS132S_IMU_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+		if (state->currentPackets.imu6 == NULL) {
+			dvs132sLog(CAER_LOG_CRITICAL, handle, "Failed to allocate IMU6 event packet.");
+			return (false);
+		}
+	}
+
+	return (true);
+}
+
 static void dvs132sEventTranslator(void *vhd, const uint8_t *buffer, size_t bufferSize) {
 	dvs132sHandle handle = vhd;
 	dvs132sState state   = &handle->state;
@@ -1101,40 +1251,11 @@ static void dvs132sEventTranslator(void *vhd, const uint8_t *buffer, size_t buff
 		bufferSize &= ~((size_t) 0x01);
 	}
 
-	for (size_t bufferPos = 0; bufferPos < bufferSize; bufferPos += 2) {
-		// Allocate new packets for next iteration as needed.
-		if (!containerGenerationAllocate(&state->container, DVS132S_EVENT_TYPES)) {
-			dvs132sLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
-			return;
-		}
-
-		if (state->currentPackets.special == NULL) {
-			state->currentPackets.special = caerSpecialEventPacketAllocate(
-				DVS132S_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.special == NULL) {
-				dvs132sLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
-				return;
-			}
-		}
-
-		if (state->currentPackets.polarity == NULL) {
-			state->currentPackets.polarity = caerPolarityEventPacketAllocate(
-				DVS132S_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.polarity == NULL) {
-				dvs132sLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
-				return;
-			}
-		}
-
-		if (state->currentPackets.imu6 == NULL) {
-			state->currentPackets.imu6 = caerIMU6EventPacketAllocate(
-				DVS132S_IMU_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.imu6 == NULL) {
-				dvs132sLog(CAER_LOG_CRITICAL, handle, "Failed to allocate IMU6 event packet.");
-				return;
-			}
-		}
+	if (!dvs132sEnsurePackets(handle)) {
+		return;
+	}
 
+	for (size_t bufferPos = 0; bufferPos < bufferSize; bufferPos += 2) {
 		bool tsReset   = false;
 		bool tsBigWrap = false;
 
@@ -1339,103 +1460,10 @@ static void dvs132sEventTranslator(void *vhd, const uint8_t *buffer, size_t buff
 					state->dvs.lastX = data;
 					break;
 
-				case 3: { // 4-pixel group event presence and polarity.
-					if (ensureSpaceForEvents((caerEventPacketHeader *) &state->currentPackets.polarity,
-							(size_t) state->currentPackets.polarityPosition, 4, handle)) {
-						bool pres0 = data & 0x0010;
-						bool pres1 = data & 0x0020;
-						bool pres2 = data & 0x0040;
-						bool pres3 = data & 0x0080;
-						bool pol0  = data & 0x0001;
-						bool pol1  = data & 0x0002;
-						bool pol2  = data & 0x0004;
-						bool pol3  = data & 0x0008;
-
-						// Pixel 0: Top Left for host-packet-order.
-						if (pres0) {
-							// Received event!
-							caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-								state->currentPackets.polarity, state->currentPackets.polarityPosition);
-
-							// Timestamp at event-stream insertion point.
-							caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-							caerPolarityEventSetPolarity(currentPolarityEvent, pol0);
-							if (state->dvs.invertXY) {
-								caerPolarityEventSetY(currentPolarityEvent, state->dvs.lastX);
-								caerPolarityEventSetX(currentPolarityEvent, state->dvs.lastY);
-							}
-							else {
-								caerPolarityEventSetY(currentPolarityEvent, state->dvs.lastY);
-								caerPolarityEventSetX(currentPolarityEvent, state->dvs.lastX);
-							}
-							caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
-							state->currentPackets.polarityPosition++;
-						}
-
-						// Pixel 1: Top Right for host-packet-order.
-						if (pres1) {
-							// Received event!
-							caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-								state->currentPackets.polarity, state->currentPackets.polarityPosition);
-
-							// Timestamp at event-stream insertion point.
-							caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-							caerPolarityEventSetPolarity(currentPolarityEvent, pol1);
-							if (state->dvs.invertXY) {
-								caerPolarityEventSetY(currentPolarityEvent, U16T(state->dvs.lastX + 1));
-								caerPolarityEventSetX(currentPolarityEvent, state->dvs.lastY);
-							}
-							else {
-								caerPolarityEventSetY(currentPolarityEvent, state->dvs.lastY);
-								caerPolarityEventSetX(currentPolarityEvent, U16T(state->dvs.lastX + 1));
-							}
-							caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
-							state->currentPackets.polarityPosition++;
-						}
-
-						if (pres2) {
-							// Received event!
-							caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-								state->currentPackets.polarity, state->currentPackets.polarityPosition);
-
-							// Timestamp at event-stream insertion point.
-							caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-							caerPolarityEventSetPolarity(currentPolarityEvent, pol2);
-							if (state->dvs.invertXY) {
-								caerPolarityEventSetY(currentPolarityEvent, state->dvs.lastX);
-								caerPolarityEventSetX(currentPolarityEvent, U16T(state->dvs.lastY + 1));
-							}
-							else {
-								caerPolarityEventSetY(currentPolarityEvent, U16T(state->dvs.lastY + 1));
-								caerPolarityEventSetX(currentPolarityEvent, state->dvs.lastX);
-							}
-							caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
-							state->currentPackets.polarityPosition++;
-						}
-
-						if (pres3) {
-							// Received event!
-							caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-								state->currentPackets.polarity, state->currentPackets.polarityPosition);
-
-							// Timestamp at event-stream insertion point.
-							caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-							caerPolarityEventSetPolarity(currentPolarityEvent, pol3);
-							if (state->dvs.invertXY) {
-								caerPolarityEventSetY(currentPolarityEvent, U16T(state->dvs.lastX + 1));
-								caerPolarityEventSetX(currentPolarityEvent, U16T(state->dvs.lastY + 1));
-							}
-							else {
-								caerPolarityEventSetY(currentPolarityEvent, U16T(state->dvs.lastY + 1));
-								caerPolarityEventSetX(currentPolarityEvent, U16T(state->dvs.lastX + 1));
-							}
-							caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
-							state->currentPackets.polarityPosition++;
-						}
-					}
-
+				case 3: // 4-pixel group event presence and polarity.
+					// Decode it and any following DVS address events in bulk.
+					bufferPos = dvsDecodeRun(handle, buffer, bufferPos, bufferSize);
 					break;
-				}
 
 				case 5: {
 					// Misc 8bit data.
@@ -1683,6 +1711,11 @@ static void dvs132sEventTranslator(void *vhd, const uint8_t *buffer, size_t buff
 			containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
 				state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun,
 				handle->info.deviceID, handle->info.deviceString, &state->deviceLogLevel);
+
+			// Committed packets are gone, get new ones for the rest of the buffer.
+			if (!dvs132sEnsurePackets(handle)) {
+				return;
+			}
 		}
 	}
 }
@@ -2484,6 +2484,46 @@ static inline bool ensureSpaceForEvents(
 	return (true);
 }
 
+// Allocate the packet container and any current packet that is missing after a
+// commit. Called once per USB buffer and after each commit, not per event.
+static bool dvXplorerEnsurePackets(dvXplorerHandle handle) {
+	dvXplorerState state = &handle->state;
+
+	if (!containerGenerationAllocate(&state->container, DVXPLORER_EVENT_TYPES)) {
+		dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
+		return (false);
+	}
+
+	if (state->currentPackets.special == NULL) {
+		state->currentPackets.special = caerSpecialEventPacketAllocate(
+			DVXPLORER_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+		if (state->currentPackets.special == NULL) {
+			dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
+			return (false);
+		}
+	}
+
+	if (state->currentPackets.polarity == NULL) {
+		state->currentPackets.polarity = caerPolarityEventPacketAllocate(
+			DVXPLORER_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+		if (state->currentPackets.polarity == NULL) {
+			dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
+			return (false);
+		}
+	}
+
+	if (state->currentPackets.imu6 == NULL) {
+		state->currentPackets.imu6 = caerIMU6EventPacketAllocate(
+			DVXPLORER_IMU_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+		if (state->currentPackets.imu6 == NULL) {
+			dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to allocate IMU6 event packet.");
+			return (false);
+		}
+	}
+
+	return (true);
+}
+
 static void dvXplorerEventTranslator(void *vhd, const uint8_t *buffer, size_t bufferSize) {
 	dvXplorerHandle handle = vhd;
 	dvXplorerState state   = &handle->state;
@@ -2502,40 +2542,11 @@ static void dvXplorerEventTranslator(void *vhd, const uint8_t *buffer, size_t bu
 		bufferSize &= ~((size_t) 0x01);
 	}
 
-	for (size_t bufferPos = 0; bufferPos < bufferSize; bufferPos += 2) {
-		// Allocate new packets for next iteration as needed.
-		if (!containerGenerationAllocate(&state->container, DVXPLORER_EVENT_TYPES)) {
-			dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
-			return;
-		}
-
-		if (state->currentPackets.special == NULL) {
-			state->currentPackets.special = caerSpecialEventPacketAllocate(
-				DVXPLORER_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.special == NULL) {
-				dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
-				return;
-			}
-		}
-
-		if (state->currentPackets.polarity == NULL) {
-			state->currentPackets.polarity = caerPolarityEventPacketAllocate(
-				DVXPLORER_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.polarity == NULL) {
-				dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
-				return;
-			}
-		}
-
-		if (state->currentPackets.imu6 == NULL) {
-			state->currentPackets.imu6 = caerIMU6EventPacketAllocate(
-				DVXPLORER_IMU_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.imu6 == NULL) {
-				dvXplorerLog(CAER_LOG_CRITICAL, handle, "Failed to allocate IMU6 event packet.");
-				return;
-			}
-		}
+	if (!dvXplorerEnsurePackets(handle)) {
+		return;
+	}
 
+	for (size_t bufferPos = 0; bufferPos < bufferSize; bufferPos += 2) {
 		bool tsReset   = false;
 		bool tsBigWrap = false;
 
@@ -3080,6 +3091,11 @@ static void dvXplorerEventTranslator(void *vhd, const uint8_t *buffer, size_t bu
 			containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
 				state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun,
 				handle->info.deviceID, handle->info.deviceString, &state->deviceLogLevel);
+
+			// Committed packets are gone, get new ones for the rest of the buffer.
+			if (!dvXplorerEnsurePackets(handle)) {
+				return;
+			}
 		}
 	}
 }
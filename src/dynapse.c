@@ -8,6 +8,24 @@ static void dynapseEventTranslator(void *vdh, const uint8_t *buffer, size_t byte
 static void setSilentBiases(caerDeviceHandle cdh, uint8_t chipId);
 static void setLowPowerBiases(caerDeviceHandle cdh, uint8_t chipId);
 
+static inline void dynapseNetworkInvalidate(dynapseState state) {
+	for (size_t chip = 0; chip < DYNAPSE_NETWORK_CHIPS; chip++) {
+		state->network.valid[chip] = false;
+	}
+}
+
+// Only CAM and SRAM words (bit 17 set, see caerDynapseGenerateCamBits() and
+// caerDynapseGenerateSramBits()) change what the network compiler programmed.
+// Bias and other chip content words keep its copy valid.
+static inline void dynapseNetworkInvalidateChipContent(dynapseState state, const uint32_t *words, size_t wordsNumber) {
+	for (size_t i = 0; i < wordsNumber; i++) {
+		if ((words[i] & U32T(0x01 << 17)) != 0) {
+			dynapseNetworkInvalidate(state);
+			return;
+		}
+	}
+}
+
 // On device IDs are different, U0 is 0, U1 is 8, U2 is 4 and U3 is 12.
 static inline uint8_t translateChipIdHostToDevice(uint8_t hostChipId) {
 	switch (hostChipId) {
@@ -246,17 +264,24 @@ static bool sendUSBCommandVerifyMultiple(dynapseHandle handle, uint8_t *config,
 	return (true);
 }
 
+static inline int32_t dynapseContainerSize(dynapseState state) {
+	// Special packet, then one or more spike packets.
+	return (DYNAPSE_SPIKE_EVENT_POS + I32T(state->currentPackets.spikeNumber));
+}
+
 static inline void freeAllDataMemory(dynapseState state) {
 	dataExchangeDestroy(&state->dataExchange);
 
 	// Since the current event packets aren't necessarily
 	// already assigned to the current packet container, we
 	// free them separately from it.
-	if (state->currentPackets.spike != NULL) {
-		free(&state->currentPackets.spike->packetHeader);
-		state->currentPackets.spike = NULL;
+	for (size_t i = 0; i < DYNAPSE_SPIKE_PACKETS_MAX; i++) {
+		if (state->currentPackets.spike[i] != NULL) {
+			free(&state->currentPackets.spike[i]->packetHeader);
+			state->currentPackets.spike[i] = NULL;
 
-		containerGenerationSetPacket(&state->container, DYNAPSE_SPIKE_EVENT_POS, NULL);
+			containerGenerationSetPacket(&state->container, DYNAPSE_SPIKE_EVENT_POS + I32T(i), NULL);
+		}
 	}
 
 	if (state->currentPackets.special != NULL) {
@@ -293,6 +318,7 @@ caerDeviceHandle dynapseOpen(
 
 	// Packet settings (size (in events) and time interval (in µs)).
 	containerGenerationSettingsInit(&state->container);
+	atomic_store(&state->spikeSplit, CAER_HOST_CONFIG_SPIKE_PACKETS_SPLIT_NONE);
 
 	// Logging settings (initialize to global log-level).
 	enum caer_log_level globalLogLevel = caerLogLevelGet();
@@ -388,6 +414,8 @@ bool dynapseClose(caerDeviceHandle cdh) {
 	dynapseLog(CAER_LOG_DEBUG, handle, "Shutdown successful.");
 
 	// Free memory.
+	free(state->network.cam);
+	free(state->network.sram);
 	free(handle->info.deviceString);
 	free(handle);
 
@@ -762,6 +790,22 @@ bool dynapseConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, u
 			return (containerGenerationConfigSet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_SPIKE_PACKETS:
+			switch (paramAddr) {
+				case CAER_HOST_CONFIG_SPIKE_PACKETS_SPLIT:
+					if (param > CAER_HOST_CONFIG_SPIKE_PACKETS_SPLIT_CORE) {
+						return (false);
+					}
+
+					atomic_store(&state->spikeSplit, param);
+					break;
+
+				default:
+					return (false);
+					break;
+			}
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -857,6 +901,9 @@ bool dynapseConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, u
 					chipConfig[4] = U8T(param >> 8);
 					chipConfig[5] = U8T(param >> 0);
 
+					// Arbitrary CAM/SRAM content, the network compiler can't know what changed anymore.
+					dynapseNetworkInvalidateChipContent(state, &param, 1);
+
 					// We use this function here instead of spiConfigSend() because
 					// we also need to verify that the AER transaction succeeded!
 					return (sendUSBCommandVerifyMultiple(handle, chipConfig, 1));
@@ -1107,6 +1154,18 @@ bool dynapseConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, u
 			return (containerGenerationConfigGet(&state->container, paramAddr, param));
 			break;
 
+		case CAER_HOST_CONFIG_SPIKE_PACKETS:
+			switch (paramAddr) {
+				case CAER_HOST_CONFIG_SPIKE_PACKETS_SPLIT:
+					*param = U32T(atomic_load(&state->spikeSplit));
+					break;
+
+				default:
+					return (false);
+					break;
+			}
+			break;
+
 		case CAER_HOST_CONFIG_LOG:
 			switch (paramAddr) {
 				case CAER_HOST_CONFIG_LOG_LEVEL:
@@ -1311,21 +1370,36 @@ bool dynapseDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr
 		return (false);
 	}
 
-	// Allocate packets.
-	if (!containerGenerationAllocate(&state->container, DYNAPSE_EVENT_TYPES)) {
+	// Spike packet layout is fixed while data is running.
+	state->currentPackets.spikeSplit = U8T(atomic_load(&state->spikeSplit));
+
+	if (state->currentPackets.spikeSplit == CAER_HOST_CONFIG_SPIKE_PACKETS_SPLIT_CORE) {
+		state->currentPackets.spikeNumber = DYNAPSE_X4BOARD_NUMCHIPS * DYNAPSE_CONFIG_NUMCORES;
+	}
+	else if (state->currentPackets.spikeSplit == CAER_HOST_CONFIG_SPIKE_PACKETS_SPLIT_CHIP) {
+		state->currentPackets.spikeNumber = DYNAPSE_X4BOARD_NUMCHIPS;
+	}
+	else {
+		state->currentPackets.spikeNumber = 1;
+	}
+
+	// Allocate packets. Split spike packets are allocated on their first spike.
+	if (!containerGenerationAllocate(&state->container, dynapseContainerSize(state))) {
 		freeAllDataMemory(state);
 
 		dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
 		return (false);
 	}
 
-	state->currentPackets.spike
-		= caerSpikeEventPacketAllocate(DYNAPSE_SPIKE_DEFAULT_SIZE, I16T(handle->info.deviceID), 0);
-	if (state->currentPackets.spike == NULL) {
-		freeAllDataMemory(state);
+	if (state->currentPackets.spikeSplit == CAER_HOST_CONFIG_SPIKE_PACKETS_SPLIT_NONE) {
+		state->currentPackets.spike[0]
+			= caerSpikeEventPacketAllocate(DYNAPSE_SPIKE_DEFAULT_SIZE, I16T(handle->info.deviceID), 0);
+		if (state->currentPackets.spike[0] == NULL) {
+			freeAllDataMemory(state);
 
-		dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to allocate spike event packet.");
-		return (false);
+			dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to allocate spike event packet.");
+			return (false);
+		}
 	}
 
 	state->currentPackets.special
@@ -1380,7 +1454,9 @@ bool dynapseDataStop(caerDeviceHandle cdh) {
 	freeAllDataMemory(state);
 
 	// Reset packet positions.
-	state->currentPackets.spikePosition   = 0;
+	for (size_t i = 0; i < DYNAPSE_SPIKE_PACKETS_MAX; i++) {
+		state->currentPackets.spikePosition[i] = 0;
+	}
 	state->currentPackets.specialPosition = 0;
 
 	return (true);
@@ -1395,6 +1471,62 @@ caerEventPacketContainer dynapseDataGet(caerDeviceHandle cdh) {
 
 #define TS_WRAP_ADD 0x8000
 
+static bool dynapseEnsureSpikePacket(dynapseHandle handle, size_t index) {
+	dynapseState state = &handle->state;
+
+	caerSpikeEventPacket *spike = &state->currentPackets.spike[index];
+	int32_t spikePosition       = state->currentPackets.spikePosition[index];
+
+	if (*spike == NULL) {
+		*spike = caerSpikeEventPacketAllocate(
+			DYNAPSE_SPIKE_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+		if (*spike == NULL) {
+			dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to allocate spike event packet.");
+			return (false);
+		}
+	}
+	else if (spikePosition >= caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) *spike)) {
+		// If not committed, let's check if any of the packets has reached its maximum
+		// capacity limit. If yes, we grow them to accomodate new events.
+		caerSpikeEventPacket grownPacket
+			= (caerSpikeEventPacket) caerEventPacketGrow((caerEventPacketHeader) *spike, spikePosition * 2);
+		if (grownPacket == NULL) {
+			dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to grow spike event packet.");
+			return (false);
+		}
+
+		*spike = grownPacket;
+	}
+
+	return (true);
+}
+
+static bool dynapseEnsureSpecialPacket(dynapseHandle handle) {
+	dynapseState state = &handle->state;
+
+	if (state->currentPackets.special == NULL) {
+		state->currentPackets.special = caerSpecialEventPacketAllocate(
+			DYNAPSE_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+		if (state->currentPackets.special == NULL) {
+			dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
+			return (false);
+		}
+	}
+	else if (state->currentPackets.specialPosition
+			 >= caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) state->currentPackets.special)) {
+		caerSpecialEventPacket grownPacket = (caerSpecialEventPacket) caerEventPacketGrow(
+			(caerEventPacketHeader) state->currentPackets.special, state->currentPackets.specialPosition * 2);
+		if (grownPacket == NULL) {
+			dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to grow special event packet.");
+			return (false);
+		}
+
+		state->currentPackets.special = grownPacket;
+	}
+
+	return (true);
+}
+
 static void dynapseEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSent) {
 	dynapseHandle handle = vhd;
 	dynapseState state   = &handle->state;
@@ -1413,57 +1545,16 @@ static void dynapseEventTranslator(void *vhd, const uint8_t *buffer, size_t byte
 		bytesSent &= ~((size_t) 0x01);
 	}
 
-	for (size_t i = 0; i < bytesSent; i += 2) {
-		// Allocate new packets for next iteration as needed.
-		if (!containerGenerationAllocate(&state->container, DYNAPSE_EVENT_TYPES)) {
-			dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
-			return;
-		}
+	// Source core ID of spikes, from the event code (1, 2, 5 and 6).
+	static const uint8_t spikeCoreID[8] = {0, 0, 1, 0, 0, 2, 3, 0};
 
-		if (state->currentPackets.spike == NULL) {
-			state->currentPackets.spike = caerSpikeEventPacketAllocate(
-				DYNAPSE_SPIKE_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.spike == NULL) {
-				dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to allocate spike event packet.");
-				return;
-			}
-		}
-		else if (state->currentPackets.spikePosition
-				 >= caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) state->currentPackets.spike)) {
-			// If not committed, let's check if any of the packets has reached its maximum
-			// capacity limit. If yes, we grow them to accomodate new events.
-			caerSpikeEventPacket grownPacket = (caerSpikeEventPacket) caerEventPacketGrow(
-				(caerEventPacketHeader) state->currentPackets.spike, state->currentPackets.spikePosition * 2);
-			if (grownPacket == NULL) {
-				dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to grow spike event packet.");
-				return;
-			}
+	uint8_t spikeSplit = state->currentPackets.spikeSplit;
 
-			state->currentPackets.spike = grownPacket;
-		}
-
-		if (state->currentPackets.special == NULL) {
-			state->currentPackets.special = caerSpecialEventPacketAllocate(
-				DYNAPSE_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.special == NULL) {
-				dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
-				return;
-			}
-		}
-		else if (state->currentPackets.specialPosition
-				 >= caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) state->currentPackets.special)) {
-			// If not committed, let's check if any of the packets has reached its maximum
-			// capacity limit. If yes, we grow them to accomodate new events.
-			caerSpecialEventPacket grownPacket = (caerSpecialEventPacket) caerEventPacketGrow(
-				(caerEventPacketHeader) state->currentPackets.special, state->currentPackets.specialPosition * 2);
-			if (grownPacket == NULL) {
-				dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to grow special event packet.");
-				return;
-			}
-
-			state->currentPackets.special = grownPacket;
-		}
+	// Packet size commit threshold, only checked on the packet an event was just added to.
+	int32_t currentPacketContainerCommitSize = containerGenerationGetMaxPacketSize(&state->container);
+	bool containerSizeCommit                 = false;
 
+	for (size_t i = 0; i < bytesSent; i += 2) {
 		bool tsReset   = false;
 		bool tsBigWrap = false;
 
@@ -1512,17 +1603,7 @@ static void dynapseEventTranslator(void *vhd, const uint8_t *buffer, size_t byte
 				case 2: // Special encoding over 4 cases.
 				case 5:
 				case 6: {
-					uint8_t sourceCoreID = 0; // code == 1
-
-					if (code == 2) {
-						sourceCoreID = 1;
-					}
-					else if (code == 5) {
-						sourceCoreID = 2;
-					}
-					else if (code == 6) {
-						sourceCoreID = 3;
-					}
+					uint8_t sourceCoreID = spikeCoreID[code];
 
 					uint8_t chipID = data & 0x0F;
 
@@ -1534,16 +1615,48 @@ static void dynapseEventTranslator(void *vhd, const uint8_t *buffer, size_t byte
 
 					uint32_t neuronID = U16T(data >> 4) & 0x00FF;
 
-					caerSpikeEvent currentSpikeEvent = caerSpikeEventPacketGetEvent(
-						state->currentPackets.spike, state->currentPackets.spikePosition);
+					size_t spikeIndex = 0;
+
+					if (spikeSplit != CAER_HOST_CONFIG_SPIKE_PACKETS_SPLIT_NONE) {
+						// Spikes from invalid chip IDs have no packet to go to.
+						if (chipID >= DYNAPSE_X4BOARD_NUMCHIPS) {
+							dynapseLog(
+								CAER_LOG_ERROR, handle, "Spike from invalid chip ID %" PRIu8 " dropped.", chipID);
+							break;
+						}
+
+						spikeIndex = (spikeSplit == CAER_HOST_CONFIG_SPIKE_PACKETS_SPLIT_CORE)
+										 ? ((size_t) (chipID * DYNAPSE_CONFIG_NUMCORES) + sourceCoreID)
+										 : (chipID);
+					}
+
+					caerSpikeEventPacket spike = state->currentPackets.spike[spikeIndex];
+					int32_t spikePosition      = state->currentPackets.spikePosition[spikeIndex];
+
+					// Packet allocation and growth are rare, keep them out of the common path.
+					if ((spike == NULL)
+						|| (spikePosition >= caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) spike))) {
+						if (!dynapseEnsureSpikePacket(handle, spikeIndex)) {
+							return;
+						}
+
+						spike = state->currentPackets.spike[spikeIndex];
+					}
+
+					caerSpikeEvent currentSpikeEvent = caerSpikeEventPacketGetEvent(spike, spikePosition);
 
 					// Timestamp at event-stream insertion point.
 					caerSpikeEventSetTimestamp(currentSpikeEvent, state->timestamps.current);
 					caerSpikeEventSetSourceCoreID(currentSpikeEvent, sourceCoreID);
 					caerSpikeEventSetChipID(currentSpikeEvent, chipID);
 					caerSpikeEventSetNeuronID(currentSpikeEvent, neuronID);
-					caerSpikeEventValidate(currentSpikeEvent, state->currentPackets.spike);
-					state->currentPackets.spikePosition++;
+					caerSpikeEventValidate(currentSpikeEvent, spike);
+
+					state->currentPackets.spikePosition[spikeIndex] = ++spikePosition;
+
+					if ((currentPacketContainerCommitSize > 0) && (spikePosition >= currentPacketContainerCommitSize)) {
+						containerSizeCommit = true;
+					}
 
 					break;
 				}
@@ -1553,12 +1666,21 @@ static void dynapseEventTranslator(void *vhd, const uint8_t *buffer, size_t byte
 						&state->timestamps, data, TS_WRAP_ADD, handle->info.deviceString, &state->deviceLogLevel);
 
 					if (tsBigWrap) {
+						if (!dynapseEnsureSpecialPacket(handle)) {
+							return;
+						}
+
 						caerSpecialEvent currentSpecialEvent = caerSpecialEventPacketGetEvent(
 							state->currentPackets.special, state->currentPackets.specialPosition);
 						caerSpecialEventSetTimestamp(currentSpecialEvent, INT32_MAX);
 						caerSpecialEventSetType(currentSpecialEvent, TIMESTAMP_WRAP);
 						caerSpecialEventValidate(currentSpecialEvent, state->currentPackets.special);
 						state->currentPackets.specialPosition++;
+
+						if ((currentPacketContainerCommitSize > 0)
+							&& (state->currentPackets.specialPosition >= currentPacketContainerCommitSize)) {
+							containerSizeCommit = true;
+						}
 					}
 					else {
 						containerGenerationCommitTimestampInit(&state->container, state->timestamps.current);
@@ -1574,30 +1696,31 @@ static void dynapseEventTranslator(void *vhd, const uint8_t *buffer, size_t byte
 		}
 
 		// Thresholds on which to trigger packet container commit.
-		// tsReset and tsBigWrap are already defined above.
-		// Trigger if any of the global container-wide thresholds are met.
-		int32_t currentPacketContainerCommitSize = containerGenerationGetMaxPacketSize(&state->container);
-		bool containerSizeCommit                 = (currentPacketContainerCommitSize > 0)
-								   && ((state->currentPackets.spikePosition >= currentPacketContainerCommitSize)
-									   || (state->currentPackets.specialPosition >= currentPacketContainerCommitSize));
-
+		// tsReset, tsBigWrap and containerSizeCommit are already defined above.
 		bool containerTimeCommit = containerGenerationIsCommitTimestampElapsed(
 			&state->container, state->timestamps.wrapOverflow, state->timestamps.current);
 
 		// Commit packet containers to the ring-buffer, so they can be processed by the
 		// main-loop, when any of the required conditions are met.
 		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit) {
+			if (!containerGenerationAllocate(&state->container, dynapseContainerSize(state))) {
+				dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
+				return;
+			}
+
 			// One or more of the commit triggers are hit. Set the packet container up to contain
 			// any non-empty packets. Empty packets are not forwarded to save memory.
 			bool emptyContainerCommit = true;
 
-			if (state->currentPackets.spikePosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, DYNAPSE_SPIKE_EVENT_POS, (caerEventPacketHeader) state->currentPackets.spike);
+			for (size_t j = 0; j < state->currentPackets.spikeNumber; j++) {
+				if (state->currentPackets.spikePosition[j] > 0) {
+					containerGenerationSetPacket(&state->container, DYNAPSE_SPIKE_EVENT_POS + I32T(j),
+						(caerEventPacketHeader) state->currentPackets.spike[j]);
 
-				state->currentPackets.spike         = NULL;
-				state->currentPackets.spikePosition = 0;
-				emptyContainerCommit                = false;
+					state->currentPackets.spike[j]         = NULL;
+					state->currentPackets.spikePosition[j] = 0;
+					emptyContainerCommit                   = false;
+				}
 			}
 
 			if (state->currentPackets.specialPosition > 0) {
@@ -1612,29 +1735,237 @@ static void dynapseEventTranslator(void *vhd, const uint8_t *buffer, size_t byte
 			containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
 				state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun,
 				handle->info.deviceID, handle->info.deviceString, &state->deviceLogLevel);
+
+			containerSizeCommit = false;
 		}
 	}
 }
 
-bool caerDynapseSendDataToUSB(caerDeviceHandle cdh, const uint32_t *pointer, size_t numConfig) {
-	dynapseHandle handle = (dynapseHandle) cdh;
+// Pipelined upload of multi-config USB transfers. Up to DYNAPSE_UPLOAD_MAX_PENDING
+// chunks are in flight at any time; each completion submits the next chunk, so the
+// control pipe never runs dry waiting on the host. Completions run on the USB thread.
+struct dynapse_upload {
+	dynapseHandle handle;
+	mtx_t lock;
+	uint8_t *config;
+	size_t configNum;
+	size_t configSubmitted;
+	size_t transfersPending;
+	bool failed;
+	bool finished;
+	uint8_t vendorRequest;
+	// Chip config is verified after every chunk.
+	bool verify;
+	// SRAM burst mode has to be disabled after the last chunk.
+	bool sramBurst;
+	void (*uploadCallback)(void *uploadCallbackPtr, bool success);
+	void *uploadCallbackPtr;
+};
+
+static void dynapseUploadSubmit(struct dynapse_upload *upload);
+static void dynapseUploadTransferDone(struct dynapse_upload *upload, bool success);
+static void dynapseUploadOutCallback(void *uploadPtr, int status);
+static void dynapseUploadVerifyCallback(void *uploadPtr, int status, const uint8_t *buffer, size_t bufferSize);
+static void dynapseUploadSramBurstCallback(void *uploadPtr, int status);
+static void dynapseUploadFinish(struct dynapse_upload *upload, bool success);
+
+static struct dynapse_upload *dynapseUploadInitialize(dynapseHandle handle, size_t configNum, uint8_t vendorRequest,
+	void (*uploadCallback)(void *uploadCallbackPtr, bool success), void *uploadCallbackPtr) {
+	struct dynapse_upload *upload = calloc(1, sizeof(struct dynapse_upload));
+	if (upload == NULL) {
+		return (NULL);
+	}
 
-	// Check if the pointer is valid.
-	if (handle == NULL) {
-		return (false);
+	upload->config = calloc(configNum, SPI_CONFIG_MSG_SIZE);
+	if (upload->config == NULL) {
+		free(upload);
+		return (NULL);
 	}
 
-	// Check if device type is supported.
-	if (handle->deviceType != CAER_DEVICE_DYNAPSE) {
-		return (false);
+	if (mtx_init(&upload->lock, mtx_plain) != thrd_success) {
+		free(upload->config);
+		free(upload);
+		return (NULL);
+	}
+
+	upload->handle            = handle;
+	upload->configNum         = configNum;
+	upload->vendorRequest     = vendorRequest;
+	upload->uploadCallback    = uploadCallback;
+	upload->uploadCallbackPtr = uploadCallbackPtr;
+
+	return (upload);
+}
+
+static void dynapseUploadDestroy(struct dynapse_upload *upload) {
+	mtx_destroy(&upload->lock);
+	free(upload->config);
+	free(upload);
+}
+
+static bool dynapseUploadStart(struct dynapse_upload *upload) {
+	mtx_lock(&upload->lock);
+
+	dynapseUploadSubmit(upload);
+
+	// Nothing could be submitted at all: fail right away, no callback.
+	bool started = (upload->transfersPending > 0);
+
+	mtx_unlock(&upload->lock);
+
+	if (!started) {
+		dynapseUploadDestroy(upload);
+	}
+
+	return (started);
+}
+
+// Must be called with the upload lock held.
+static void dynapseUploadSubmit(struct dynapse_upload *upload) {
+	dynapseState state = &upload->handle->state;
+
+	size_t transfersPerChunk = (upload->verify) ? (2) : (1);
+
+	while ((!upload->failed) && (upload->configSubmitted < upload->configNum)
+		   && ((upload->transfersPending + transfersPerChunk) <= (DYNAPSE_UPLOAD_MAX_PENDING * transfersPerChunk))) {
+		size_t configNum = upload->configNum - upload->configSubmitted;
+		if (configNum > SPI_CONFIG_MAX) {
+			configNum = SPI_CONFIG_MAX;
+		}
+
+		if (!usbControlTransferOutAsync(&state->usbState, upload->vendorRequest, U16T(configNum), 0,
+				upload->config + (upload->configSubmitted * SPI_CONFIG_MSG_SIZE), configNum * SPI_CONFIG_MSG_SIZE,
+				&dynapseUploadOutCallback, upload)) {
+			dynapseLog(CAER_LOG_CRITICAL, upload->handle, "Failed to send config chunk, USB transfer failed.");
+			upload->failed = true;
+			break;
+		}
+
+		upload->transfersPending++;
+		upload->configSubmitted += configNum;
+
+		// Control transfers complete in order, so each verification reads
+		// back the status of the chunk sent right before it.
+		if (upload->verify) {
+			if (!usbControlTransferInAsync(&state->usbState, upload->vendorRequest, 0, 0, 2,
+					&dynapseUploadVerifyCallback, upload)) {
+				dynapseLog(CAER_LOG_CRITICAL, upload->handle, "Failed to verify config chunk, USB transfer failed.");
+				upload->failed = true;
+				break;
+			}
+
+			upload->transfersPending++;
+		}
+	}
+}
+
+static void dynapseUploadTransferDone(struct dynapse_upload *upload, bool success) {
+	mtx_lock(&upload->lock);
+
+	upload->transfersPending--;
+
+	if (!success) {
+		upload->failed = true;
+	}
+
+	dynapseUploadSubmit(upload);
+
+	// Done when nothing is in flight anymore, and either all was sent or something failed.
+	bool finished = (upload->transfersPending == 0) && (!upload->finished)
+					&& (upload->failed || (upload->configSubmitted == upload->configNum));
+	if (finished) {
+		upload->finished = true;
 	}
 
+	mtx_unlock(&upload->lock);
+
+	if (!finished) {
+		return;
+	}
+
+	if (upload->sramBurst) {
+		// Disable burst mode again or things will go wrong when accessing the SRAM in the future.
+		// This is needed on failures too.
+		if (spiConfigSendAsync(&upload->handle->state.usbState, DYNAPSE_CONFIG_SRAM, DYNAPSE_CONFIG_SRAM_BURSTMODE, 0,
+				&dynapseUploadSramBurstCallback, upload)) {
+			return;
+		}
+
+		upload->failed = true;
+	}
+
+	dynapseUploadFinish(upload, !upload->failed);
+}
+
+static void dynapseUploadOutCallback(void *uploadPtr, int status) {
+	struct dynapse_upload *upload = uploadPtr;
+
+	if (status != LIBUSB_TRANSFER_COMPLETED) {
+		dynapseLog(CAER_LOG_CRITICAL, upload->handle, "Failed to send config chunk, USB transfer failed.");
+	}
+
+	dynapseUploadTransferDone(upload, (status == LIBUSB_TRANSFER_COMPLETED));
+}
+
+static void dynapseUploadVerifyCallback(void *uploadPtr, int status, const uint8_t *buffer, size_t bufferSize) {
+	struct dynapse_upload *upload = uploadPtr;
+
+	bool success = (status == LIBUSB_TRANSFER_COMPLETED) && (bufferSize == 2) && (buffer[0] == upload->vendorRequest)
+				   && (buffer[1] == 0);
+	if (!success) {
+		dynapseLog(
+			CAER_LOG_CRITICAL, upload->handle, "Failed to send chip config, USB transfer failed on verification.");
+	}
+
+	dynapseUploadTransferDone(upload, success);
+}
+
+static void dynapseUploadSramBurstCallback(void *uploadPtr, int status) {
+	struct dynapse_upload *upload = uploadPtr;
+
+	dynapseUploadFinish(upload, (!upload->failed) && (status == LIBUSB_TRANSFER_COMPLETED));
+}
+
+static void dynapseUploadFinish(struct dynapse_upload *upload, bool success) {
+	if (upload->uploadCallback != NULL) {
+		(*upload->uploadCallback)(upload->uploadCallbackPtr, success);
+	}
+
+	dynapseUploadDestroy(upload);
+}
+
+// Implement synchronous uploads over the asynchronous ones, like USB control
+// transfers do: wait till the completion callback is done.
+static void dynapseUploadSyncCallback(void *completedPtr, bool success) {
+	atomic_uint_fast32_t *completed = completedPtr;
+
+	atomic_store(completed, (success) ? (1) : (2));
+}
+
+static bool dynapseUploadWait(atomic_uint_fast32_t *completed) {
+	// Sleep for 100µs to avoid busy loop.
+	struct timespec waitForCompletionSleep = {.tv_sec = 0, .tv_nsec = 100000};
+
+	while (!atomic_load(completed)) {
+		thrd_sleep(&waitForCompletionSleep, NULL);
+	}
+
+	return (atomic_load(completed) == 1);
+}
+
+static bool dynapseUploadChipContentAsync(dynapseHandle handle, const uint32_t *pointer, size_t numConfig,
+	void (*uploadCallback)(void *uploadCallbackPtr, bool success), void *uploadCallbackPtr) {
 	// Allocate memory for configuration parameters.
-	uint8_t *spiMultiConfig = calloc(numConfig, SPI_CONFIG_MSG_SIZE);
-	if (spiMultiConfig == NULL) {
+	struct dynapse_upload *upload = dynapseUploadInitialize(
+		handle, numConfig, VENDOR_REQUEST_FPGA_CONFIG_AER_MULTIPLE, uploadCallback, uploadCallbackPtr);
+	if (upload == NULL) {
 		return (false);
 	}
 
+	upload->verify = true;
+
+	uint8_t *spiMultiConfig = upload->config;
+
 	for (size_t i = 0; i < numConfig; i++) {
 		spiMultiConfig[(i * SPI_CONFIG_MSG_SIZE) + 0] = DYNAPSE_CONFIG_CHIP;
 		spiMultiConfig[(i * SPI_CONFIG_MSG_SIZE) + 1] = DYNAPSE_CONFIG_CHIP_CONTENT;
@@ -1644,26 +1975,50 @@ bool caerDynapseSendDataToUSB(caerDeviceHandle cdh, const uint32_t *pointer, siz
 		spiMultiConfig[(i * SPI_CONFIG_MSG_SIZE) + 5] = U8T((pointer[i] >> 0) & 0x0FF);
 	}
 
-	size_t idxConfig = 0;
+	return (dynapseUploadStart(upload));
+}
 
-	while (numConfig > 0) {
-		size_t configNum  = (numConfig > SPI_CONFIG_MAX) ? (SPI_CONFIG_MAX) : (numConfig);
-		size_t configSize = configNum * SPI_CONFIG_MSG_SIZE;
+bool caerDynapseSendDataToUSBAsync(caerDeviceHandle cdh, const uint32_t *pointer, size_t numConfig,
+	void (*uploadCallback)(void *uploadCallbackPtr, bool success), void *uploadCallbackPtr) {
+	dynapseHandle handle = (dynapseHandle) cdh;
 
-		if (!sendUSBCommandVerifyMultiple(handle, spiMultiConfig + idxConfig, configNum)) {
-			free(spiMultiConfig);
-			return (false);
+	// Check if the pointer is valid.
+	if (handle == NULL) {
+		return (false);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType != CAER_DEVICE_DYNAPSE) {
+		return (false);
+	}
+
+	// Nothing to send, the upload is complete right away.
+	if (numConfig == 0) {
+		if (uploadCallback != NULL) {
+			(*uploadCallback)(uploadCallbackPtr, true);
 		}
 
-		numConfig -= configNum;
-		idxConfig += configSize;
+		return (true);
 	}
 
-	free(spiMultiConfig);
-	return (true);
+	// Arbitrary CAM/SRAM content, the network compiler can't know what changed anymore.
+	dynapseNetworkInvalidateChipContent(&handle->state, pointer, numConfig);
+
+	return (dynapseUploadChipContentAsync(handle, pointer, numConfig, uploadCallback, uploadCallbackPtr));
 }
 
-bool caerDynapseWriteSramWords(caerDeviceHandle cdh, const uint16_t *data, uint32_t baseAddr, size_t numWords) {
+bool caerDynapseSendDataToUSB(caerDeviceHandle cdh, const uint32_t *pointer, size_t numConfig) {
+	atomic_uint_fast32_t completed = ATOMIC_VAR_INIT(0);
+
+	if (!caerDynapseSendDataToUSBAsync(cdh, pointer, numConfig, &dynapseUploadSyncCallback, &completed)) {
+		return (false);
+	}
+
+	return (dynapseUploadWait(&completed));
+}
+
+bool caerDynapseWriteSramWordsAsync(caerDeviceHandle cdh, const uint16_t *data, uint32_t baseAddr, size_t numWords,
+	void (*uploadCallback)(void *uploadCallbackPtr, bool success), void *uploadCallbackPtr) {
 	dynapseHandle handle = (dynapseHandle) cdh;
 
 	// Check if the pointer is valid.
@@ -1678,6 +2033,45 @@ bool caerDynapseWriteSramWords(caerDeviceHandle cdh, const uint16_t *data, uint3
 
 	dynapseState state = &handle->state;
 
+	// Nothing to write, the upload is complete right away.
+	if (numWords == 0) {
+		if (uploadCallback != NULL) {
+			(*uploadCallback)(uploadCallbackPtr, true);
+		}
+
+		return (true);
+	}
+
+	// Bursts transfer pairs of words: a single word is a normal SRAM write,
+	// sent as one upload of its three configuration steps.
+	if (numWords == 1) {
+		const uint8_t paramAddrs[3] = {
+			DYNAPSE_CONFIG_SRAM_RWCOMMAND, DYNAPSE_CONFIG_SRAM_WRITEDATA, DYNAPSE_CONFIG_SRAM_ADDRESS};
+		const uint32_t params[3] = {DYNAPSE_CONFIG_SRAM_WRITE, data[0], baseAddr};
+
+		struct dynapse_upload *upload = dynapseUploadInitialize(
+			handle, 3, VENDOR_REQUEST_FPGA_CONFIG_MULTIPLE, uploadCallback, uploadCallbackPtr);
+		if (upload == NULL) {
+			return (false);
+		}
+
+		for (size_t i = 0; i < 3; i++) {
+			upload->config[(i * SPI_CONFIG_MSG_SIZE) + 0] = DYNAPSE_CONFIG_SRAM;
+			upload->config[(i * SPI_CONFIG_MSG_SIZE) + 1] = paramAddrs[i];
+			upload->config[(i * SPI_CONFIG_MSG_SIZE) + 2] = U8T((params[i] >> 24) & 0x0FF);
+			upload->config[(i * SPI_CONFIG_MSG_SIZE) + 3] = U8T((params[i] >> 16) & 0x0FF);
+			upload->config[(i * SPI_CONFIG_MSG_SIZE) + 4] = U8T((params[i] >> 8) & 0x0FF);
+			upload->config[(i * SPI_CONFIG_MSG_SIZE) + 5] = U8T((params[i] >> 0) & 0x0FF);
+		}
+
+		if (!dynapseUploadStart(upload)) {
+			dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to send SRAM word, USB transfer failed.");
+			return (false);
+		}
+
+		return (true);
+	}
+
 	// Handle even and odd numbers of words to write.
 	if ((numWords & 0x01) != 0) {
 		// Handle the case where we have one trailing word
@@ -1692,19 +2086,16 @@ bool caerDynapseWriteSramWords(caerDeviceHandle cdh, const uint16_t *data, uint3
 		numWords--;
 	}
 
-	// Return if there was only one word to write, or none.
-	if (numWords == 0) {
-		return (true);
-	}
-
 	size_t numConfig = numWords / 2;
 
-	// We need malloc because allocating dynamically sized arrays on the stack is not allowed.
-	uint8_t *spiMultiConfig = calloc(numConfig, SPI_CONFIG_MSG_SIZE);
-	if (spiMultiConfig == NULL) {
+	struct dynapse_upload *upload = dynapseUploadInitialize(
+		handle, numConfig, VENDOR_REQUEST_FPGA_CONFIG_MULTIPLE, uploadCallback, uploadCallbackPtr);
+	if (upload == NULL) {
 		return (false);
 	}
 
+	uint8_t *spiMultiConfig = upload->config;
+
 	for (size_t i = 0; i < numConfig; i++) {
 		// Data word configuration.
 		spiMultiConfig[(i * SPI_CONFIG_MSG_SIZE) + 0] = DYNAPSE_CONFIG_SRAM;
@@ -1724,29 +2115,26 @@ bool caerDynapseWriteSramWords(caerDeviceHandle cdh, const uint16_t *data, uint3
 	// Then we enable burst mode for faster writing.
 	spiConfigSend(&state->usbState, DYNAPSE_CONFIG_SRAM, DYNAPSE_CONFIG_SRAM_BURSTMODE, 1);
 
-	size_t idxConfig = 0;
+	upload->sramBurst = true;
+
+	if (!dynapseUploadStart(upload)) {
+		dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to send SRAM burst data, USB transfer failed.");
 
-	while (numConfig > 0) {
-		size_t configNum  = (numConfig > SPI_CONFIG_MAX) ? (SPI_CONFIG_MAX) : (numConfig);
-		size_t configSize = configNum * SPI_CONFIG_MSG_SIZE;
+		spiConfigSend(&state->usbState, DYNAPSE_CONFIG_SRAM, DYNAPSE_CONFIG_SRAM_BURSTMODE, 0);
+		return (false);
+	}
 
-		if (!usbControlTransferOut(&state->usbState, VENDOR_REQUEST_FPGA_CONFIG_MULTIPLE, U16T(configNum), 0,
-				spiMultiConfig + idxConfig, configSize)) {
-			dynapseLog(CAER_LOG_CRITICAL, handle, "Failed to send SRAM burst data, USB transfer failed.");
+	return (true);
+}
 
-			free(spiMultiConfig);
-			return (false);
-		}
+bool caerDynapseWriteSramWords(caerDeviceHandle cdh, const uint16_t *data, uint32_t baseAddr, size_t numWords) {
+	atomic_uint_fast32_t completed = ATOMIC_VAR_INIT(0);
 
-		numConfig -= configNum;
-		idxConfig += configSize;
+	if (!caerDynapseWriteSramWordsAsync(cdh, data, baseAddr, numWords, &dynapseUploadSyncCallback, &completed)) {
+		return (false);
 	}
 
-	// Disable burst mode again or things will go wrong when accessing the SRAM in the future.
-	spiConfigSend(&state->usbState, DYNAPSE_CONFIG_SRAM, DYNAPSE_CONFIG_SRAM_BURSTMODE, 0);
-
-	free(spiMultiConfig);
-	return (true);
+	return (dynapseUploadWait(&completed));
 }
 
 bool caerDynapseWriteCam(
@@ -1794,6 +2182,387 @@ bool caerDynapseWriteSramN(caerDeviceHandle cdh, uint16_t neuronAddr, uint8_t sr
 	return (caerDeviceConfigSet(cdh, DYNAPSE_CONFIG_CHIP, DYNAPSE_CONFIG_CHIP_CONTENT, sramBits));
 }
 
+// Network compiler. The cache holds one key per CAM and SRAM cell, zero
+// meaning an empty cell, from which the actual chip content is generated.
+static inline uint16_t networkCamKey(uint16_t sourceNeuronAddr, uint8_t synapseType) {
+	return (U16T(0x1000 | ((synapseType & 0x03) << 10) | (sourceNeuronAddr & 0x03FF)));
+}
+
+static inline uint8_t networkSramKey(uint8_t targetChipId, uint8_t targetCores) {
+	return (U8T(0x40 | ((targetChipId & 0x03) << 4) | (targetCores & 0x0F)));
+}
+
+// Position of the chips on the board, in chips from the south-west corner:
+// U0 and U1 are north of U2 and U3, U1 and U3 are east of U0 and U2.
+static const int8_t networkChipX[DYNAPSE_NETWORK_CHIPS] = {0, 1, 0, 1};
+static const int8_t networkChipY[DYNAPSE_NETWORK_CHIPS] = {1, 1, 0, 0};
+
+static uint32_t networkCamBits(uint16_t neuronAddr, uint8_t camId, uint16_t key) {
+	if (key == 0) {
+		// Same as DYNAPSE_CONFIG_CLEAR_CAM.
+		return (caerDynapseGenerateCamBits(0, neuronAddr, camId, 0));
+	}
+
+	return (caerDynapseGenerateCamBits(key & 0x03FF, neuronAddr, camId, U8T((key >> 10) & 0x03)));
+}
+
+static uint32_t networkSramBits(uint8_t chipId, uint16_t neuronAddr, uint8_t sramId, uint8_t key) {
+	if (key == 0) {
+		// No destination core disables routing.
+		return (caerDynapseGenerateSramBits(neuronAddr, sramId, 0, 0, 0, 0, 0, 0));
+	}
+
+	uint8_t targetChipId = (key >> 4) & 0x03;
+	int dx               = networkChipX[targetChipId] - networkChipX[chipId];
+	int dy               = networkChipY[targetChipId] - networkChipY[chipId];
+
+	// The source core is kept as virtual core, CAMs match on the full 10 bit neuron address.
+	return (caerDynapseGenerateSramBits(neuronAddr, sramId, U8T(neuronAddr >> 8) & 0x03,
+		(dx < 0) ? (DYNAPSE_CONFIG_SRAM_DIRECTION_X_WEST) : (DYNAPSE_CONFIG_SRAM_DIRECTION_X_EAST), U8T(abs(dx)),
+		(dy < 0) ? (DYNAPSE_CONFIG_SRAM_DIRECTION_Y_SOUTH) : (DYNAPSE_CONFIG_SRAM_DIRECTION_Y_NORTH), U8T(abs(dy)),
+		key & 0x0F));
+}
+
+// Place a neuron's inputs into its CAMs. Inputs that are already programmed
+// stay where they are, new ones go into free cells, unused cells are emptied.
+static void networkAllocateCams(const uint16_t *cached, const uint16_t *inputs, size_t inputsNumber, uint16_t *next) {
+	bool used[DYNAPSE_CONFIG_NUMCAM_NEU]   = {false};
+	bool placed[DYNAPSE_CONFIG_NUMCAM_NEU] = {false};
+
+	for (size_t i = 0; i < inputsNumber; i++) {
+		for (size_t cam = 0; cam < DYNAPSE_CONFIG_NUMCAM_NEU; cam++) {
+			if ((!used[cam]) && (cached[cam] == inputs[i])) {
+				next[cam] = inputs[i];
+				used[cam] = true;
+				placed[i] = true;
+				break;
+			}
+		}
+	}
+
+	size_t cam = 0;
+
+	for (size_t i = 0; i < inputsNumber; i++) {
+		if (placed[i]) {
+			continue;
+		}
+
+		while (used[cam]) {
+			cam++;
+		}
+
+		next[cam] = inputs[i];
+		used[cam] = true;
+	}
+
+	for (cam = 0; cam < DYNAPSE_CONFIG_NUMCAM_NEU; cam++) {
+		if (!used[cam]) {
+			next[cam] = 0;
+		}
+	}
+}
+
+// Same for a neuron's routes, one SRAM cell per target chip. A route to a
+// chip that is already programmed keeps its cell, even if its cores change.
+static void networkAllocateSrams(const uint8_t *cached, const uint8_t *targetCores, uint8_t *next) {
+	bool used[DYNAPSE_CONFIG_NUMSRAM_NEU] = {false};
+	bool placed[DYNAPSE_NETWORK_CHIPS]    = {false};
+
+	for (uint8_t chip = 0; chip < DYNAPSE_NETWORK_CHIPS; chip++) {
+		if (targetCores[chip] == 0) {
+			continue;
+		}
+
+		for (size_t sram = DYNAPSE_NETWORK_FIRST_SRAM; sram < DYNAPSE_CONFIG_NUMSRAM_NEU; sram++) {
+			if ((!used[sram]) && (cached[sram] != 0) && (((cached[sram] >> 4) & 0x03) == chip)) {
+				next[sram]   = networkSramKey(chip, targetCores[chip]);
+				used[sram]   = true;
+				placed[chip] = true;
+				break;
+			}
+		}
+	}
+
+	size_t sram = DYNAPSE_NETWORK_FIRST_SRAM;
+
+	for (uint8_t chip = 0; chip < DYNAPSE_NETWORK_CHIPS; chip++) {
+		if ((targetCores[chip] == 0) || placed[chip]) {
+			continue;
+		}
+
+		while (used[sram]) {
+			sram++;
+		}
+
+		next[sram] = networkSramKey(chip, targetCores[chip]);
+		used[sram] = true;
+	}
+
+	for (sram = DYNAPSE_NETWORK_FIRST_SRAM; sram < DYNAPSE_CONFIG_NUMSRAM_NEU; sram++) {
+		if (!used[sram]) {
+			next[sram] = 0;
+		}
+	}
+}
+
+static bool networkAppendWord(uint32_t **words, size_t *wordsSize, size_t *wordsCapacity, uint32_t word) {
+	if (*wordsSize == *wordsCapacity) {
+		size_t newCapacity = (*wordsCapacity == 0) ? (1024) : (*wordsCapacity * 2);
+
+		uint32_t *newWords = realloc(*words, newCapacity * sizeof(uint32_t));
+		if (newWords == NULL) {
+			return (false);
+		}
+
+		*words         = newWords;
+		*wordsCapacity = newCapacity;
+	}
+
+	(*words)[(*wordsSize)++] = word;
+
+	return (true);
+}
+
+struct network_tables {
+	// Inputs of each neuron on the board, as CAM keys: inputs of neuron N
+	// are at camInputs[camStart[N]] up to camInputs[camStart[N + 1]].
+	size_t *camStart;
+	uint16_t *camInputs;
+	// Cores each neuron on the board sends to, per target chip.
+	uint8_t *sramTargetCores;
+	// New cache content of the chip being compiled.
+	uint16_t *camNext;
+	uint8_t *sramNext;
+	// Changed chip content to upload.
+	uint32_t *words;
+	size_t wordsSize;
+	size_t wordsCapacity;
+};
+
+static bool networkBuildTables(dynapseHandle handle, struct network_tables *tables,
+	const struct caer_dynapse_connection *connections, size_t numConnections) {
+	size_t neuronsNumber = DYNAPSE_NETWORK_CHIPS * DYNAPSE_CONFIG_NUMNEURONS;
+
+	for (size_t i = 0; i < numConnections; i++) {
+		const struct caer_dynapse_connection *conn = &connections[i];
+
+		if ((conn->sourceChipId >= DYNAPSE_NETWORK_CHIPS) || (conn->targetChipId >= DYNAPSE_NETWORK_CHIPS)
+			|| (conn->sourceNeuronAddr >= DYNAPSE_CONFIG_NUMNEURONS)
+			|| (conn->targetNeuronAddr >= DYNAPSE_CONFIG_NUMNEURONS) || (conn->synapseType > 0x03)) {
+			dynapseLog(CAER_LOG_ERROR, handle, "Network: invalid connection %zu.", i);
+			return (false);
+		}
+
+		size_t source = ((size_t) conn->sourceChipId * DYNAPSE_CONFIG_NUMNEURONS) + conn->sourceNeuronAddr;
+		size_t target = ((size_t) conn->targetChipId * DYNAPSE_CONFIG_NUMNEURONS) + conn->targetNeuronAddr;
+
+		tables->camStart[target + 1]++;
+		tables->sramTargetCores[(source * DYNAPSE_NETWORK_CHIPS) + conn->targetChipId]
+			|= U8T(0x01 << (conn->targetNeuronAddr >> 8));
+	}
+
+	for (size_t neuron = 0; neuron < neuronsNumber; neuron++) {
+		if (tables->camStart[neuron + 1] > DYNAPSE_CONFIG_NUMCAM_NEU) {
+			dynapseLog(CAER_LOG_ERROR, handle, "Network: neuron %zu of chip %zu has more than %d inputs.",
+				neuron % DYNAPSE_CONFIG_NUMNEURONS, neuron / DYNAPSE_CONFIG_NUMNEURONS, DYNAPSE_CONFIG_NUMCAM_NEU);
+			return (false);
+		}
+
+		size_t targetChips = 0;
+		for (size_t chip = 0; chip < DYNAPSE_NETWORK_CHIPS; chip++) {
+			targetChips += (tables->sramTargetCores[(neuron * DYNAPSE_NETWORK_CHIPS) + chip] != 0);
+		}
+
+		if (targetChips > (DYNAPSE_CONFIG_NUMSRAM_NEU - DYNAPSE_NETWORK_FIRST_SRAM)) {
+			dynapseLog(CAER_LOG_ERROR, handle, "Network: neuron %zu of chip %zu sends to more than %d chips.",
+				neuron % DYNAPSE_CONFIG_NUMNEURONS, neuron / DYNAPSE_CONFIG_NUMNEURONS,
+				DYNAPSE_CONFIG_NUMSRAM_NEU - DYNAPSE_NETWORK_FIRST_SRAM);
+			return (false);
+		}
+
+		tables->camStart[neuron + 1] += tables->camStart[neuron];
+	}
+
+	// Fill in the inputs, in connection order per neuron.
+	size_t *camFill = tables->camStart + neuronsNumber + 1;
+	memcpy(camFill, tables->camStart, neuronsNumber * sizeof(size_t));
+
+	for (size_t i = 0; i < numConnections; i++) {
+		const struct caer_dynapse_connection *conn = &connections[i];
+
+		size_t target = ((size_t) conn->targetChipId * DYNAPSE_CONFIG_NUMNEURONS) + conn->targetNeuronAddr;
+
+		// CAMs only see the 10 bit source neuron address, not its chip.
+		tables->camInputs[camFill[target]++] = networkCamKey(conn->sourceNeuronAddr, conn->synapseType);
+	}
+
+	return (true);
+}
+
+static bool networkCompileChip(dynapseHandle handle, struct network_tables *tables, uint8_t chipId) {
+	dynapseState state = &handle->state;
+
+	// Without a valid cache, the chip content is unknown: write everything.
+	bool writeAll = !state->network.valid[chipId];
+
+	uint16_t emptyCams[DYNAPSE_CONFIG_NUMCAM_NEU]  = {0};
+	uint8_t emptySrams[DYNAPSE_CONFIG_NUMSRAM_NEU] = {0};
+
+	tables->wordsSize = 0;
+
+	for (uint16_t neuronAddr = 0; neuronAddr < DYNAPSE_CONFIG_NUMNEURONS; neuronAddr++) {
+		size_t neuron = ((size_t) chipId * DYNAPSE_CONFIG_NUMNEURONS) + neuronAddr;
+
+		const uint16_t *camCached
+			= (writeAll) ? (emptyCams) : (&state->network.cam[neuron * DYNAPSE_CONFIG_NUMCAM_NEU]);
+		const uint8_t *sramCached
+			= (writeAll) ? (emptySrams) : (&state->network.sram[neuron * DYNAPSE_CONFIG_NUMSRAM_NEU]);
+
+		uint16_t *camNext = &tables->camNext[neuronAddr * DYNAPSE_CONFIG_NUMCAM_NEU];
+		uint8_t *sramNext = &tables->sramNext[neuronAddr * DYNAPSE_CONFIG_NUMSRAM_NEU];
+
+		networkAllocateCams(camCached, &tables->camInputs[tables->camStart[neuron]],
+			tables->camStart[neuron + 1] - tables->camStart[neuron], camNext);
+
+		sramNext[0] = sramCached[0];
+		networkAllocateSrams(sramCached, &tables->sramTargetCores[neuron * DYNAPSE_NETWORK_CHIPS], sramNext);
+
+		for (uint8_t cam = 0; cam < DYNAPSE_CONFIG_NUMCAM_NEU; cam++) {
+			if ((writeAll || (camNext[cam] != camCached[cam]))
+				&& !networkAppendWord(&tables->words, &tables->wordsSize, &tables->wordsCapacity,
+					networkCamBits(neuronAddr, cam, camNext[cam]))) {
+				return (false);
+			}
+		}
+
+		for (uint8_t sram = DYNAPSE_NETWORK_FIRST_SRAM; sram < DYNAPSE_CONFIG_NUMSRAM_NEU; sram++) {
+			if ((writeAll || (sramNext[sram] != sramCached[sram]))
+				&& !networkAppendWord(&tables->words, &tables->wordsSize, &tables->wordsCapacity,
+					networkSramBits(chipId, neuronAddr, sram, sramNext[sram]))) {
+				return (false);
+			}
+		}
+	}
+
+	if (tables->wordsSize == 0) {
+		// Nothing changed on this chip.
+		return (true);
+	}
+
+	dynapseLog(CAER_LOG_DEBUG, handle, "Network: writing %zu CAM/SRAM words to chip %" PRIu8 ".", tables->wordsSize,
+		chipId);
+
+	// Until the upload succeeded, the chip content is unknown.
+	state->network.valid[chipId] = false;
+
+	if (!caerDeviceConfigSet((caerDeviceHandle) handle, DYNAPSE_CONFIG_CHIP, DYNAPSE_CONFIG_CHIP_ID, chipId)) {
+		return (false);
+	}
+
+	atomic_uint_fast32_t completed = ATOMIC_VAR_INIT(0);
+
+	if (!dynapseUploadChipContentAsync(
+			handle, tables->words, tables->wordsSize, &dynapseUploadSyncCallback, &completed)
+		|| !dynapseUploadWait(&completed)) {
+		return (false);
+	}
+
+	size_t chipOffset = (size_t) chipId * DYNAPSE_CONFIG_NUMNEURONS;
+
+	memcpy(&state->network.cam[chipOffset * DYNAPSE_CONFIG_NUMCAM_NEU], tables->camNext,
+		DYNAPSE_CONFIG_NUMNEURONS * DYNAPSE_CONFIG_NUMCAM_NEU * sizeof(uint16_t));
+	memcpy(&state->network.sram[chipOffset * DYNAPSE_CONFIG_NUMSRAM_NEU], tables->sramNext,
+		DYNAPSE_CONFIG_NUMNEURONS * DYNAPSE_CONFIG_NUMSRAM_NEU * sizeof(uint8_t));
+
+	state->network.valid[chipId] = true;
+
+	return (true);
+}
+
+static void networkTablesFree(struct network_tables *tables) {
+	free(tables->camStart);
+	free(tables->camInputs);
+	free(tables->sramTargetCores);
+	free(tables->camNext);
+	free(tables->sramNext);
+	free(tables->words);
+}
+
+bool caerDynapseWriteNetwork(
+	caerDeviceHandle cdh, const struct caer_dynapse_connection *connections, size_t numConnections) {
+	dynapseHandle handle = (dynapseHandle) cdh;
+
+	// Check if the pointer is valid.
+	if (handle == NULL) {
+		return (false);
+	}
+
+	// Check if device type is supported.
+	if (handle->deviceType != CAER_DEVICE_DYNAPSE) {
+		return (false);
+	}
+
+	if ((connections == NULL) && (numConnections > 0)) {
+		return (false);
+	}
+
+	dynapseState state = &handle->state;
+
+	size_t neuronsNumber = DYNAPSE_NETWORK_CHIPS * DYNAPSE_CONFIG_NUMNEURONS;
+
+	// Allocate the cache on first use. It starts out invalid.
+	if (state->network.cam == NULL) {
+		state->network.cam  = calloc(neuronsNumber * DYNAPSE_CONFIG_NUMCAM_NEU, sizeof(uint16_t));
+		state->network.sram = calloc(neuronsNumber * DYNAPSE_CONFIG_NUMSRAM_NEU, sizeof(uint8_t));
+
+		if ((state->network.cam == NULL) || (state->network.sram == NULL)) {
+			free(state->network.cam);
+			free(state->network.sram);
+			state->network.cam  = NULL;
+			state->network.sram = NULL;
+
+			dynapseLog(CAER_LOG_CRITICAL, handle, "Network: failed to allocate memory for CAM/SRAM cache.");
+			return (false);
+		}
+
+		dynapseNetworkInvalidate(state);
+	}
+
+	struct network_tables tables = {0};
+
+	// Start offsets and fill positions share one allocation.
+	tables.camStart        = calloc((2 * neuronsNumber) + 1, sizeof(size_t));
+	tables.camInputs       = malloc(((numConnections > 0) ? (numConnections) : (1)) * sizeof(uint16_t));
+	tables.sramTargetCores = calloc(neuronsNumber * DYNAPSE_NETWORK_CHIPS, sizeof(uint8_t));
+	tables.camNext         = malloc(DYNAPSE_CONFIG_NUMNEURONS * DYNAPSE_CONFIG_NUMCAM_NEU * sizeof(uint16_t));
+	tables.sramNext        = malloc(DYNAPSE_CONFIG_NUMNEURONS * DYNAPSE_CONFIG_NUMSRAM_NEU * sizeof(uint8_t));
+
+	if ((tables.camStart == NULL) || (tables.camInputs == NULL) || (tables.sramTargetCores == NULL)
+		|| (tables.camNext == NULL) || (tables.sramNext == NULL)) {
+		networkTablesFree(&tables);
+
+		dynapseLog(CAER_LOG_CRITICAL, handle, "Network: failed to allocate memory for compilation.");
+		return (false);
+	}
+
+	if (!networkBuildTables(handle, &tables, connections, numConnections)) {
+		networkTablesFree(&tables);
+		return (false);
+	}
+
+	for (uint8_t chipId = 0; chipId < DYNAPSE_NETWORK_CHIPS; chipId++) {
+		if (!networkCompileChip(handle, &tables, chipId)) {
+			networkTablesFree(&tables);
+
+			dynapseLog(CAER_LOG_ERROR, handle, "Network: failed to program chip %" PRIu8 ".", chipId);
+			return (false);
+		}
+	}
+
+	networkTablesFree(&tables);
+	return (true);
+}
+
 bool caerDynapseWritePoissonSpikeRate(caerDeviceHandle cdh, uint16_t neuronAddr, float rateHz) {
 	dynapseHandle handle = (dynapseHandle) cdh;
 
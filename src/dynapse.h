@@ -24,9 +24,21 @@
 #define DYNAPSE_SPIKE_DEFAULT_SIZE   4096
 #define DYNAPSE_SPECIAL_DEFAULT_SIZE 128
 
+// Up to one spike packet per core of the board, see CAER_HOST_CONFIG_SPIKE_PACKETS_SPLIT.
+// They take container positions DYNAPSE_SPIKE_EVENT_POS and following.
+#define DYNAPSE_SPIKE_PACKETS_MAX (DYNAPSE_X4BOARD_NUMCHIPS * DYNAPSE_CONFIG_NUMCORES)
+
 #define SPI_CONFIG_MSG_SIZE 6
 #define SPI_CONFIG_MAX      85
 
+// Maximum number of config chunks in flight during pipelined uploads.
+#define DYNAPSE_UPLOAD_MAX_PENDING 8
+
+// Network compiler: chips on the board, and first SRAM cell it can use
+// (SRAM 0 of each neuron is reserved for monitoring, see DEFAULT_SRAM).
+#define DYNAPSE_NETWORK_CHIPS      4
+#define DYNAPSE_NETWORK_FIRST_SRAM 1
+
 #define DYNAPSE_FX2_USB_CLOCK_FREQ 30
 
 // Chip ID 0 cannot be used for USB output, so we have to shift it by
@@ -44,14 +56,25 @@ struct dynapse_state {
 	struct timestamps_state_new_logic timestamps;
 	// Packet Container state
 	struct container_generation container;
+	// Spike packet split setting, applied on data start.
+	atomic_uint_fast32_t spikeSplit;
 	struct {
-		// Spike Packet state
-		caerSpikeEventPacket spike;
-		int32_t spikePosition;
+		// Spike Packet state, one packet per chip or core if split.
+		uint8_t spikeSplit;
+		size_t spikeNumber;
+		caerSpikeEventPacket spike[DYNAPSE_SPIKE_PACKETS_MAX];
+		int32_t spikePosition[DYNAPSE_SPIKE_PACKETS_MAX];
 		// Special Packet state
 		caerSpecialEventPacket special;
 		int32_t specialPosition;
 	} currentPackets;
+	struct {
+		// Host-side copy of the CAM and SRAM contents programmed by the network compiler,
+		// per chip. Any other CAM or SRAM write invalidates it, bias writes do not.
+		uint16_t *cam;
+		uint8_t *sram;
+		bool valid[DYNAPSE_NETWORK_CHIPS];
+	} network;
 };
 
 typedef struct dynapse_state *dynapseState;
@@ -14,6 +14,8 @@ static bool serialThreadStart(edvsHandle handle);
 static void serialThreadStop(edvsHandle handle);
 static int serialThreadRun(void *handlePtr);
 static void edvsEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSent);
+static bool edvsEnsurePackets(edvsHandle handle, int32_t eventsNumber);
+static bool edvsTranslateEvent(edvsHandle handle, const uint8_t *event, int32_t remainingEvents);
 static bool edvsSendBiases(edvsState state, int biasID);
 
 static void edvsLog(enum caer_log_level logLevel, edvsHandle handle, const char *format, ...) {
@@ -365,6 +367,8 @@ caerDeviceHandle edvsOpen(uint16_t deviceID, const char *serialPortName, uint32_
 
 	// Setup serial port communication.
 	atomic_store(&state->serialState.serialReadSize, 1024);
+	atomic_store(&state->serialState.serialMinBatch, EDVS_SERIAL_MIN_BATCH_DEFAULT);
+	atomic_store(&state->serialState.serialMaxLatency, EDVS_SERIAL_MAX_LATENCY_DEFAULT);
 
 	// Populate info variables based on data from device.
 	handle->info.deviceID       = I16T(deviceID);
@@ -453,6 +457,14 @@ bool edvsConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, uint
 					atomic_store(&state->serialState.serialReadSize, param);
 					break;
 
+				case CAER_HOST_CONFIG_SERIAL_MIN_BATCH:
+					atomic_store(&state->serialState.serialMinBatch, param);
+					break;
+
+				case CAER_HOST_CONFIG_SERIAL_MAX_LATENCY:
+					atomic_store(&state->serialState.serialMaxLatency, param);
+					break;
+
 				default:
 					return (false);
 					break;
@@ -555,6 +567,14 @@ bool edvsConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, uint
 					*param = U32T(atomic_load(&state->serialState.serialReadSize));
 					break;
 
+				case CAER_HOST_CONFIG_SERIAL_MIN_BATCH:
+					*param = U32T(atomic_load(&state->serialState.serialMinBatch));
+					break;
+
+				case CAER_HOST_CONFIG_SERIAL_MAX_LATENCY:
+					*param = U32T(atomic_load(&state->serialState.serialMaxLatency));
+					break;
+
 				default:
 					return (false);
 					break;
@@ -630,8 +650,27 @@ bool edvsConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr, uint
 }
 
 static bool serialThreadStart(edvsHandle handle) {
+	struct serial_state *serialState = &handle->state.serialState;
+
+	// Serial thread blocks on these until data arrives, instead of polling.
+	if (sp_new_event_set(&serialState->serialEvents) != SP_OK) {
+		edvsLog(CAER_LOG_CRITICAL, handle, "Failed to create serial port event set.");
+		return (false);
+	}
+
+	if (sp_add_port_events(serialState->serialEvents, serialState->serialPort, SP_EVENT_RX_READY) != SP_OK) {
+		sp_free_event_set(serialState->serialEvents);
+		serialState->serialEvents = NULL;
+
+		edvsLog(CAER_LOG_CRITICAL, handle, "Failed to add serial port to event set.");
+		return (false);
+	}
+
 	// Start serial communication thread.
-	if ((errno = thrd_create(&handle->state.serialState.serialThread, &serialThreadRun, handle)) != thrd_success) {
+	if ((errno = thrd_create(&serialState->serialThread, &serialThreadRun, handle)) != thrd_success) {
+		sp_free_event_set(serialState->serialEvents);
+		serialState->serialEvents = NULL;
+
 		edvsLog(CAER_LOG_CRITICAL, handle, "Failed to create serial thread. Error: %d.", errno);
 		return (false);
 	}
@@ -652,6 +691,13 @@ static void serialThreadStop(edvsHandle handle) {
 		// This should never happen!
 		edvsLog(CAER_LOG_CRITICAL, handle, "Failed to join serial thread. Error: %d.", errno);
 	}
+
+	sp_free_event_set(handle->state.serialState.serialEvents);
+	handle->state.serialState.serialEvents = NULL;
+
+	free(handle->state.serialState.serialReadBuffer);
+	handle->state.serialState.serialReadBuffer     = NULL;
+	handle->state.serialState.serialReadBufferSize = 0;
 }
 
 static int serialThreadRun(void *handlePtr) {
@@ -672,27 +718,73 @@ static int serialThreadRun(void *handlePtr) {
 
 	edvsLog(CAER_LOG_DEBUG, handle, "Serial communication thread running.");
 
-	// Handle serial port reading (wait on data, 10 ms timeout).
+	// Handle serial port reading (block until data arrives, then collect a batch).
 	while (atomic_load_explicit(&state->serialState.serialThreadState, memory_order_relaxed) == THR_RUNNING) {
-		size_t readSize = atomic_load_explicit(&state->serialState.serialReadSize, memory_order_relaxed);
+		size_t readSize  = atomic_load_explicit(&state->serialState.serialReadSize, memory_order_relaxed);
+		size_t minBatch  = atomic_load_explicit(&state->serialState.serialMinBatch, memory_order_relaxed);
+		uint32_t latency = U32T(atomic_load_explicit(&state->serialState.serialMaxLatency, memory_order_relaxed));
 
-		// Wait for at least 16 full events to be present in the buffer.
-		int bytesAvailable = 0;
+		// Ensure read size is a multiple of event size.
+		readSize &= (size_t) ~0x03;
 
-		while ((bytesAvailable < (16 * EDVS_EVENT_SIZE))
-			   && atomic_load_explicit(&state->serialState.serialThreadState, memory_order_relaxed) == THR_RUNNING) {
-			bytesAvailable = sp_input_waiting(state->serialState.serialPort);
+		if (readSize < EDVS_EVENT_SIZE) {
+			readSize = EDVS_EVENT_SIZE;
 		}
 
-		if ((size_t) bytesAvailable < readSize) {
-			readSize = (size_t) bytesAvailable;
+		if (minBatch > readSize) {
+			minBatch = readSize;
 		}
 
-		// Ensure read size is a multiple of event size.
-		readSize &= (size_t) ~0x03;
+		// Reuse the read buffer, only grow it when the read size goes up.
+		if (readSize > state->serialState.serialReadBufferSize) {
+			uint8_t *newBuffer = realloc(state->serialState.serialReadBuffer, readSize);
+			if (newBuffer == NULL) {
+				edvsLog(CAER_LOG_CRITICAL, handle, "Failed to allocate serial read buffer.");
+
+				// ERROR: call exceptional shut-down callback and exit.
+				if (state->serialState.serialShutdownCallback != NULL) {
+					state->serialState.serialShutdownCallback(state->serialState.serialShutdownCallbackPtr);
+				}
+				break;
+			}
+
+			state->serialState.serialReadBuffer     = newBuffer;
+			state->serialState.serialReadBufferSize = readSize;
+		}
+
+		// Sleep until data arrives. Time out regularly to check for shut-down.
+		int bytesAvailable = sp_input_waiting(state->serialState.serialPort);
+
+		if (bytesAvailable == 0) {
+			if (sp_wait(state->serialState.serialEvents, EDVS_SERIAL_WAIT_TIMEOUT) != SP_OK) {
+				bytesAvailable = -1;
+			}
+			else {
+				bytesAvailable = sp_input_waiting(state->serialState.serialPort);
+			}
+		}
+
+		int bytesRead = 0;
+
+		if (bytesAvailable > 0) {
+			// Get all available data, and block up to the maximum latency
+			// for more to arrive if that's less than the minimum batch.
+			size_t availableSize = ((size_t) bytesAvailable < readSize) ? ((size_t) bytesAvailable) : (readSize);
+			size_t batchSize     = (availableSize > minBatch) ? (availableSize) : (minBatch);
+
+			if ((latency == 0) || (availableSize == batchSize)) {
+				bytesRead = sp_nonblocking_read(
+					state->serialState.serialPort, state->serialState.serialReadBuffer, availableSize);
+			}
+			else {
+				bytesRead = sp_blocking_read(
+					state->serialState.serialPort, state->serialState.serialReadBuffer, batchSize, latency);
+			}
+		}
+		else if (bytesAvailable < 0) {
+			bytesRead = bytesAvailable;
+		}
 
-		uint8_t dataBuffer[readSize];
-		int bytesRead = sp_blocking_read(state->serialState.serialPort, dataBuffer, readSize, 10);
 		if (bytesRead < 0) {
 			// ERROR: call exceptional shut-down callback and exit.
 			if (state->serialState.serialShutdownCallback != NULL) {
@@ -701,9 +793,10 @@ static int serialThreadRun(void *handlePtr) {
 			break;
 		}
 
-		if (bytesRead >= EDVS_EVENT_SIZE) {
-			// Read something (at least 1 possible event), process it and try again.
-			edvsEventTranslator(handle, dataBuffer, (size_t) bytesRead);
+		if (bytesRead > 0) {
+			// Read something, process it and try again. Partial events are
+			// carried over to the next read by the translator.
+			edvsEventTranslator(handle, state->serialState.serialReadBuffer, (size_t) bytesRead);
 		}
 	}
 
@@ -728,6 +821,9 @@ bool edvsDataStart(caerDeviceHandle cdh, void (*dataNotifyIncrease)(void *ptr),
 
 	containerGenerationCommitTimestampReset(&state->container);
 
+	// Nothing to carry over from a previous run.
+	state->carryOver.size = 0;
+
 	if (!dataExchangeBufferInit(&state->dataExchange)) {
 		edvsLog(CAER_LOG_CRITICAL, handle, "Failed to initialize data exchange buffer.");
 		return (false);
@@ -809,234 +905,309 @@ caerEventPacketContainer edvsDataGet(caerDeviceHandle cdh) {
 #define HIGH_BIT_MASK 0x80
 #define LOW_BITS_MASK 0x7F
 
-static void edvsEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSent) {
-	edvsHandle handle = vhd;
-	edvsState state   = &handle->state;
+// Make sure the current packets exist and have space for the given number of
+// additional events, so the per-event path does not need to check for it.
+// Special events can only be generated once per event (big wraps), so the same
+// number is reserved for them.
+static bool edvsEnsurePackets(edvsHandle handle, int32_t eventsNumber) {
+	edvsState state = &handle->state;
 
-	// Return right away if not running anymore. This prevents useless work if many
-	// buffers are still waiting when shut down, as well as incorrect event sequences
-	// if a TS_RESET is stuck on ring-buffer commit further down, and detects shut-down;
-	// then any subsequent buffers should also detect shut-down and not be handled.
-	if (atomic_load(&state->serialState.serialThreadState) != THR_RUNNING) {
-		return;
+	if (!containerGenerationAllocate(&state->container, EDVS_EVENT_TYPES)) {
+		edvsLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
+		return (false);
 	}
 
-	size_t i = 0;
-	while (i < bytesSent) {
-		uint8_t yByte = buffer[i];
+	if (state->currentPackets.polarity == NULL) {
+		int32_t capacity = (eventsNumber > EDVS_POLARITY_DEFAULT_SIZE) ? (eventsNumber) : (EDVS_POLARITY_DEFAULT_SIZE);
 
-		if ((yByte & HIGH_BIT_MASK) != HIGH_BIT_MASK) {
-			edvsLog(
-				CAER_LOG_NOTICE, handle, "Data not aligned, skipping to next data byte (%zu of %zu).", i, bytesSent);
-			i++;
-			continue;
+		state->currentPackets.polarity = caerPolarityEventPacketAllocate(
+			capacity, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+		if (state->currentPackets.polarity == NULL) {
+			edvsLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
+			return (false);
 		}
-
-		if ((i + 3) >= bytesSent) {
-			// Cannot fetch next event data, we're done with this buffer.
-			return;
+	}
+	else if ((state->currentPackets.polarityPosition + eventsNumber)
+			 > caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) state->currentPackets.polarity)) {
+		// If not committed, let's check if any of the packets would go over its maximum
+		// capacity limit. If yes, we grow them to accomodate new events.
+		int32_t newCapacity = state->currentPackets.polarityPosition * 2;
+		if (newCapacity < (state->currentPackets.polarityPosition + eventsNumber)) {
+			newCapacity = state->currentPackets.polarityPosition + eventsNumber;
 		}
 
-		// Allocate new packets for next iteration as needed.
-		if (!containerGenerationAllocate(&state->container, EDVS_EVENT_TYPES)) {
-			edvsLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
-			return;
+		caerPolarityEventPacket grownPacket = (caerPolarityEventPacket) caerEventPacketGrow(
+			(caerEventPacketHeader) state->currentPackets.polarity, newCapacity);
+		if (grownPacket == NULL) {
+			edvsLog(CAER_LOG_CRITICAL, handle, "Failed to grow polarity event packet.");
+			return (false);
 		}
 
-		if (state->currentPackets.polarity == NULL) {
-			state->currentPackets.polarity = caerPolarityEventPacketAllocate(
-				EDVS_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.polarity == NULL) {
-				edvsLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
-				return;
-			}
-		}
-		else if (state->currentPackets.polarityPosition
-				 >= caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) state->currentPackets.polarity)) {
-			// If not committed, let's check if any of the packets has reached its maximum
-			// capacity limit. If yes, we grow them to accomodate new events.
-			caerPolarityEventPacket grownPacket = (caerPolarityEventPacket) caerEventPacketGrow(
-				(caerEventPacketHeader) state->currentPackets.polarity, state->currentPackets.polarityPosition * 2);
-			if (grownPacket == NULL) {
-				edvsLog(CAER_LOG_CRITICAL, handle, "Failed to grow polarity event packet.");
-				return;
-			}
+		state->currentPackets.polarity = grownPacket;
+	}
 
-			state->currentPackets.polarity = grownPacket;
-		}
+	if (state->currentPackets.special == NULL) {
+		int32_t capacity = (eventsNumber > EDVS_SPECIAL_DEFAULT_SIZE) ? (eventsNumber) : (EDVS_SPECIAL_DEFAULT_SIZE);
 
+		state->currentPackets.special = caerSpecialEventPacketAllocate(
+			capacity, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
 		if (state->currentPackets.special == NULL) {
-			state->currentPackets.special = caerSpecialEventPacketAllocate(
-				EDVS_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.special == NULL) {
-				edvsLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
-				return;
-			}
+			edvsLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
+			return (false);
+		}
+	}
+	else if ((state->currentPackets.specialPosition + eventsNumber)
+			 > caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) state->currentPackets.special)) {
+		int32_t newCapacity = state->currentPackets.specialPosition * 2;
+		if (newCapacity < (state->currentPackets.specialPosition + eventsNumber)) {
+			newCapacity = state->currentPackets.specialPosition + eventsNumber;
 		}
-		else if (state->currentPackets.specialPosition
-				 >= caerEventPacketHeaderGetEventCapacity((caerEventPacketHeader) state->currentPackets.special)) {
-			// If not committed, let's check if any of the packets has reached its maximum
-			// capacity limit. If yes, we grow them to accomodate new events.
-			caerSpecialEventPacket grownPacket = (caerSpecialEventPacket) caerEventPacketGrow(
-				(caerEventPacketHeader) state->currentPackets.special, state->currentPackets.specialPosition * 2);
-			if (grownPacket == NULL) {
-				edvsLog(CAER_LOG_CRITICAL, handle, "Failed to grow special event packet.");
-				return;
-			}
 
-			state->currentPackets.special = grownPacket;
+		caerSpecialEventPacket grownPacket = (caerSpecialEventPacket) caerEventPacketGrow(
+			(caerEventPacketHeader) state->currentPackets.special, newCapacity);
+		if (grownPacket == NULL) {
+			edvsLog(CAER_LOG_CRITICAL, handle, "Failed to grow special event packet.");
+			return (false);
 		}
 
-		bool tsReset   = false;
-		bool tsBigWrap = false;
+		state->currentPackets.special = grownPacket;
+	}
 
-		uint8_t xByte   = buffer[i + 1];
-		uint8_t ts1Byte = buffer[i + 2];
-		uint8_t ts2Byte = buffer[i + 3];
+	return (true);
+}
 
-		uint16_t shortTS = U16T((ts1Byte << 8) | ts2Byte);
+// Translate one full, aligned event (first byte has the high bit set).
+// remainingEvents is the number of events that may still follow in the current
+// buffer, to size new packets after a commit. Returns false on fatal errors.
+static bool edvsTranslateEvent(edvsHandle handle, const uint8_t *event, int32_t remainingEvents) {
+	edvsState state = &handle->state;
 
-		// Timestamp reset.
-		if (atomic_load(&state->dvs.tsReset)) {
-			atomic_store(&state->dvs.tsReset, false);
+	bool tsReset   = false;
+	bool tsBigWrap = false;
 
-			// Send TS reset command to device. Ignore errors.
-			const char *cmdTSReset = "!ET0\n";
-			serialPortWrite(state, cmdTSReset);
+	uint8_t yByte   = event[0];
+	uint8_t xByte   = event[1];
+	uint8_t ts1Byte = event[2];
+	uint8_t ts2Byte = event[3];
 
-			state->timestamps.wrapOverflow = 0;
-			state->timestamps.wrapAdd      = 0;
-			state->timestamps.lastShort    = 0;
-			state->timestamps.last         = 0;
-			state->timestamps.current      = 0;
-			containerGenerationCommitTimestampReset(&state->container);
-			containerGenerationCommitTimestampInit(&state->container, state->timestamps.current);
+	uint16_t shortTS = U16T((ts1Byte << 8) | ts2Byte);
 
-			// Defer timestamp reset event to later, so we commit it
-			// alone, in its own packet.
-			// Commit packets when doing a reset to clearly separate them.
-			tsReset = true;
-		}
-		else {
-			bool tsWrap = (shortTS < state->timestamps.lastShort);
+	// Timestamp reset.
+	if (atomic_load(&state->dvs.tsReset)) {
+		atomic_store(&state->dvs.tsReset, false);
 
-			// Timestamp big wrap.
-			if (tsWrap && (state->timestamps.wrapAdd == (INT32_MAX - (TS_WRAP_ADD - 1)))) {
-				// Reset wrapAdd to zero at this point, so we can again
-				// start detecting overruns of the 32bit value.
-				state->timestamps.wrapAdd = 0;
+		// Send TS reset command to device. Ignore errors.
+		const char *cmdTSReset = "!ET0\n";
+		serialPortWrite(state, cmdTSReset);
 
-				state->timestamps.lastShort = 0;
+		state->timestamps.wrapOverflow = 0;
+		state->timestamps.wrapAdd      = 0;
+		state->timestamps.lastShort    = 0;
+		state->timestamps.last         = 0;
+		state->timestamps.current      = 0;
+		containerGenerationCommitTimestampReset(&state->container);
+		containerGenerationCommitTimestampInit(&state->container, state->timestamps.current);
+
+		// Defer timestamp reset event to later, so we commit it
+		// alone, in its own packet.
+		// Commit packets when doing a reset to clearly separate them.
+		tsReset = true;
+	}
+	else {
+		bool tsWrap = (shortTS < state->timestamps.lastShort);
+
+		// Timestamp big wrap.
+		if (tsWrap && (state->timestamps.wrapAdd == (INT32_MAX - (TS_WRAP_ADD - 1)))) {
+			// Reset wrapAdd to zero at this point, so we can again
+			// start detecting overruns of the 32bit value.
+			state->timestamps.wrapAdd = 0;
 
-				state->timestamps.last    = 0;
-				state->timestamps.current = 0;
+			state->timestamps.lastShort = 0;
 
-				// Increment TSOverflow counter.
-				state->timestamps.wrapOverflow++;
+			state->timestamps.last    = 0;
+			state->timestamps.current = 0;
 
-				caerSpecialEvent currentEvent = caerSpecialEventPacketGetEvent(
-					state->currentPackets.special, state->currentPackets.specialPosition++);
-				caerSpecialEventSetTimestamp(currentEvent, INT32_MAX);
-				caerSpecialEventSetType(currentEvent, TIMESTAMP_WRAP);
-				caerSpecialEventValidate(currentEvent, state->currentPackets.special);
+			// Increment TSOverflow counter.
+			state->timestamps.wrapOverflow++;
 
-				// Commit packets to separate before wrap from after cleanly.
-				tsBigWrap = true;
+			caerSpecialEvent currentEvent = caerSpecialEventPacketGetEvent(
+				state->currentPackets.special, state->currentPackets.specialPosition++);
+			caerSpecialEventSetTimestamp(currentEvent, INT32_MAX);
+			caerSpecialEventSetType(currentEvent, TIMESTAMP_WRAP);
+			caerSpecialEventValidate(currentEvent, state->currentPackets.special);
+
+			// Commit packets to separate before wrap from after cleanly.
+			tsBigWrap = true;
+		}
+		else {
+			if (tsWrap) {
+				// Timestamp normal wrap (every ~65 ms).
+				state->timestamps.wrapAdd += TS_WRAP_ADD;
+
+				state->timestamps.lastShort = 0;
 			}
 			else {
-				if (tsWrap) {
-					// Timestamp normal wrap (every ~65 ms).
-					state->timestamps.wrapAdd += TS_WRAP_ADD;
+				// Not a wrap, set this to track wrapping.
+				state->timestamps.lastShort = shortTS;
+			}
 
-					state->timestamps.lastShort = 0;
-				}
-				else {
-					// Not a wrap, set this to track wrapping.
-					state->timestamps.lastShort = shortTS;
-				}
+			// Expand to 32 bits. (Tick is 1µs already.)
+			state->timestamps.last    = state->timestamps.current;
+			state->timestamps.current = state->timestamps.wrapAdd + shortTS;
+			containerGenerationCommitTimestampInit(&state->container, state->timestamps.current);
 
-				// Expand to 32 bits. (Tick is 1µs already.)
-				state->timestamps.last    = state->timestamps.current;
-				state->timestamps.current = state->timestamps.wrapAdd + shortTS;
-				containerGenerationCommitTimestampInit(&state->container, state->timestamps.current);
-
-				// Check monotonicity of timestamps.
-				checkMonotonicTimestamp(state->timestamps.current, state->timestamps.last, handle->info.deviceString,
-					&handle->state.deviceLogLevel);
-
-				uint8_t x     = (xByte & LOW_BITS_MASK);
-				uint8_t y     = (yByte & LOW_BITS_MASK);
-				bool polarity = !(xByte & HIGH_BIT_MASK);
-
-				// Check range conformity.
-				if ((x < EDVS_ARRAY_SIZE_X) && (y < EDVS_ARRAY_SIZE_Y)) {
-					caerPolarityEvent currentEvent = caerPolarityEventPacketGetEvent(
-						state->currentPackets.polarity, state->currentPackets.polarityPosition++);
-					caerPolarityEventSetTimestamp(currentEvent, state->timestamps.current);
-					caerPolarityEventSetPolarity(currentEvent, polarity);
-					caerPolarityEventSetY(currentEvent, y);
-					caerPolarityEventSetX(currentEvent, x);
-					caerPolarityEventValidate(currentEvent, state->currentPackets.polarity);
+			// Check monotonicity of timestamps.
+			checkMonotonicTimestamp(state->timestamps.current, state->timestamps.last, handle->info.deviceString,
+				&handle->state.deviceLogLevel);
+
+			uint8_t x     = (xByte & LOW_BITS_MASK);
+			uint8_t y     = (yByte & LOW_BITS_MASK);
+			bool polarity = !(xByte & HIGH_BIT_MASK);
+
+			// Check range conformity.
+			if ((x < EDVS_ARRAY_SIZE_X) && (y < EDVS_ARRAY_SIZE_Y)) {
+				caerPolarityEvent currentEvent = caerPolarityEventPacketGetEvent(
+					state->currentPackets.polarity, state->currentPackets.polarityPosition++);
+				caerPolarityEventSetTimestamp(currentEvent, state->timestamps.current);
+				caerPolarityEventSetPolarity(currentEvent, polarity);
+				caerPolarityEventSetY(currentEvent, y);
+				caerPolarityEventSetX(currentEvent, x);
+				caerPolarityEventValidate(currentEvent, state->currentPackets.polarity);
+			}
+			else {
+				if (x >= EDVS_ARRAY_SIZE_X) {
+					edvsLog(CAER_LOG_ALERT, handle, "X address out of range (0-%d): %" PRIu16 ".",
+						EDVS_ARRAY_SIZE_X - 1, x);
 				}
-				else {
-					if (x >= EDVS_ARRAY_SIZE_X) {
-						edvsLog(CAER_LOG_ALERT, handle, "X address out of range (0-%d): %" PRIu16 ".",
-							EDVS_ARRAY_SIZE_X - 1, x);
-					}
-					if (y >= EDVS_ARRAY_SIZE_Y) {
-						edvsLog(CAER_LOG_ALERT, handle, "Y address out of range (0-%d): %" PRIu16 ".",
-							EDVS_ARRAY_SIZE_Y - 1, y);
-					}
+				if (y >= EDVS_ARRAY_SIZE_Y) {
+					edvsLog(CAER_LOG_ALERT, handle, "Y address out of range (0-%d): %" PRIu16 ".",
+						EDVS_ARRAY_SIZE_Y - 1, y);
 				}
 			}
 		}
+	}
 
-		// Thresholds on which to trigger packet container commit.
-		// tsReset and tsBigWrap are already defined above.
-		// Trigger if any of the global container-wide thresholds are met.
-		int32_t currentPacketContainerCommitSize = containerGenerationGetMaxPacketSize(&state->container);
-		bool containerSizeCommit                 = (currentPacketContainerCommitSize > 0)
-								   && ((state->currentPackets.polarityPosition >= currentPacketContainerCommitSize)
-									   || (state->currentPackets.specialPosition >= currentPacketContainerCommitSize));
-
-		bool containerTimeCommit = containerGenerationIsCommitTimestampElapsed(
-			&state->container, state->timestamps.wrapOverflow, state->timestamps.current);
-
-		// NOTE: with the current EDVS architecture, currentTimestamp always comes together
-		// with an event, so the very first event that matches this threshold will be
-		// also part of the committed packet container. This doesn't break any of the invariants.
-
-		// Commit packet containers to the ring-buffer, so they can be processed by the
-		// main-loop, when any of the required conditions are met.
-		if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit) {
-			// One or more of the commit triggers are hit. Set the packet container up to contain
-			// any non-empty packets. Empty packets are not forwarded to save memory.
-			bool emptyContainerCommit = true;
-
-			if (state->currentPackets.polarityPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
-
-				state->currentPackets.polarity         = NULL;
-				state->currentPackets.polarityPosition = 0;
-				emptyContainerCommit                   = false;
-			}
+	// Thresholds on which to trigger packet container commit.
+	// tsReset and tsBigWrap are already defined above.
+	// Trigger if any of the global container-wide thresholds are met.
+	int32_t currentPacketContainerCommitSize = containerGenerationGetMaxPacketSize(&state->container);
+	bool containerSizeCommit                 = (currentPacketContainerCommitSize > 0)
+							   && ((state->currentPackets.polarityPosition >= currentPacketContainerCommitSize)
+								   || (state->currentPackets.specialPosition >= currentPacketContainerCommitSize));
+
+	bool containerTimeCommit = containerGenerationIsCommitTimestampElapsed(
+		&state->container, state->timestamps.wrapOverflow, state->timestamps.current);
+
+	// NOTE: with the current EDVS architecture, currentTimestamp always comes together
+	// with an event, so the very first event that matches this threshold will be
+	// also part of the committed packet container. This doesn't break any of the invariants.
+
+	// Commit packet containers to the ring-buffer, so they can be processed by the
+	// main-loop, when any of the required conditions are met.
+	if (tsReset || tsBigWrap || containerSizeCommit || containerTimeCommit) {
+		// One or more of the commit triggers are hit. Set the packet container up to contain
+		// any non-empty packets. Empty packets are not forwarded to save memory.
+		bool emptyContainerCommit = true;
+
+		if (state->currentPackets.polarityPosition > 0) {
+			containerGenerationSetPacket(
+				&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
+
+			state->currentPackets.polarity         = NULL;
+			state->currentPackets.polarityPosition = 0;
+			emptyContainerCommit                   = false;
+		}
+
+		if (state->currentPackets.specialPosition > 0) {
+			containerGenerationSetPacket(
+				&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
+
+			state->currentPackets.special         = NULL;
+			state->currentPackets.specialPosition = 0;
+			emptyContainerCommit                  = false;
+		}
+
+		containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
+			state->timestamps.current, &state->dataExchange, &state->serialState.serialThreadState,
+			handle->info.deviceID, handle->info.deviceString, &handle->state.deviceLogLevel);
 
-			if (state->currentPackets.specialPosition > 0) {
-				containerGenerationSetPacket(
-					&state->container, SPECIAL_EVENT, (caerEventPacketHeader) state->currentPackets.special);
+		// Committed packets are gone, get new ones for the rest of the buffer.
+		if (!edvsEnsurePackets(handle, remainingEvents)) {
+			return (false);
+		}
+	}
 
-				state->currentPackets.special         = NULL;
-				state->currentPackets.specialPosition = 0;
-				emptyContainerCommit                  = false;
+	return (true);
+}
+
+static void edvsEventTranslator(void *vhd, const uint8_t *buffer, size_t bytesSent) {
+	edvsHandle handle = vhd;
+	edvsState state   = &handle->state;
+
+	// Return right away if not running anymore. This prevents useless work if many
+	// buffers are still waiting when shut down, as well as incorrect event sequences
+	// if a TS_RESET is stuck on ring-buffer commit further down, and detects shut-down;
+	// then any subsequent buffers should also detect shut-down and not be handled.
+	if (atomic_load(&state->serialState.serialThreadState) != THR_RUNNING) {
+		return;
+	}
+
+	size_t i = 0;
+
+	// Complete the partial event left over at the end of the previous buffer.
+	if (state->carryOver.size > 0) {
+		size_t missing = EDVS_EVENT_SIZE - state->carryOver.size;
+
+		if (bytesSent < missing) {
+			memcpy(&state->carryOver.bytes[state->carryOver.size], buffer, bytesSent);
+			state->carryOver.size += bytesSent;
+			return;
+		}
+
+		memcpy(&state->carryOver.bytes[state->carryOver.size], buffer, missing);
+		state->carryOver.size = 0;
+		i                     = missing;
+	}
+
+	// Space for all events this buffer can hold, plus the completed one.
+	int32_t remainingEvents = I32T((bytesSent - i) / EDVS_EVENT_SIZE);
+
+	if (!edvsEnsurePackets(handle, remainingEvents + 1)) {
+		return;
+	}
+
+	if ((i > 0) && !edvsTranslateEvent(handle, state->carryOver.bytes, remainingEvents)) {
+		return;
+	}
+
+	while (i < bytesSent) {
+		// Fast path: run of aligned events.
+		while (((i + EDVS_EVENT_SIZE) <= bytesSent) && ((buffer[i] & HIGH_BIT_MASK) == HIGH_BIT_MASK)) {
+			remainingEvents = I32T((bytesSent - i) / EDVS_EVENT_SIZE) - 1;
+
+			if (!edvsTranslateEvent(handle, &buffer[i], remainingEvents)) {
+				return;
 			}
 
-			containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
-				state->timestamps.current, &state->dataExchange, &state->serialState.serialThreadState,
-				handle->info.deviceID, handle->info.deviceString, &handle->state.deviceLogLevel);
+			i += EDVS_EVENT_SIZE;
+		}
+
+		if (i >= bytesSent) {
+			break;
+		}
+
+		if ((buffer[i] & HIGH_BIT_MASK) != HIGH_BIT_MASK) {
+			// Resynchronize on the next byte that can start an event.
+			edvsLog(
+				CAER_LOG_NOTICE, handle, "Data not aligned, skipping to next data byte (%zu of %zu).", i, bytesSent);
+			i++;
+			continue;
 		}
 
-		i += 4;
+		// Partial event at the end of the buffer, keep it for the next one.
+		state->carryOver.size = bytesSent - i;
+		memcpy(state->carryOver.bytes, &buffer[i], state->carryOver.size);
+		break;
 	}
 }
 
@@ -26,6 +26,11 @@
 #define EDVS_POLARITY_DEFAULT_SIZE 4096
 #define EDVS_SPECIAL_DEFAULT_SIZE  128
 
+#define EDVS_SERIAL_MIN_BATCH_DEFAULT   (16 * EDVS_EVENT_SIZE)
+#define EDVS_SERIAL_MAX_LATENCY_DEFAULT 1
+// How often a serial thread blocked on an idle port checks for shut-down (in ms).
+#define EDVS_SERIAL_WAIT_TIMEOUT 10
+
 #define BIAS_NUMBER 12
 #define BIAS_LENGTH 3
 
@@ -36,8 +41,13 @@ struct serial_state {
 	// Serial thread state
 	thrd_t serialThread;
 	atomic_uint_fast32_t serialThreadState;
+	struct sp_event_set *serialEvents;
 	// Serial Data Transfers
 	atomic_uint_fast32_t serialReadSize;
+	atomic_uint_fast32_t serialMinBatch;
+	atomic_uint_fast32_t serialMaxLatency;
+	uint8_t *serialReadBuffer;
+	size_t serialReadBufferSize;
 	// Serial Data Transfers shutdown callback
 	void (*serialShutdownCallback)(void *serialShutdownCallbackPtr);
 	void *serialShutdownCallbackPtr;
@@ -58,6 +68,11 @@ struct edvs_state {
 		int32_t current;
 		uint16_t lastShort; // For wrap detection.
 	} timestamps;
+	// Partial event at the end of the last serial read.
+	struct {
+		uint8_t bytes[EDVS_EVENT_SIZE];
+		size_t size;
+	} carryOver;
 	// Packet Container state
 	struct container_generation container;
 	struct {
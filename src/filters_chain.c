@@ -0,0 +1,253 @@
+#include "libcaer/filters/chain.h"
+
+#include "filters_dvs_noise.h"
+#include "filters_dvs_spatial.h"
+
+enum filter_chain_stage_type {
+	STAGE_DVS_NOISE,
+	STAGE_DVS_SPATIAL,
+	STAGE_ROI,
+	STAGE_DECIMATION,
+	STAGE_POLARITY_SELECT,
+	STAGE_CALLBACK,
+};
+
+struct filter_chain_stage {
+	enum filter_chain_stage_type type;
+	uint64_t dropped;
+	union {
+		caerFilterDVSNoise noiseFilter;
+		caerFilterDVSSpatial spatialFilter;
+		struct {
+			uint16_t startX;
+			uint16_t startY;
+			uint16_t endX;
+			uint16_t endY;
+		} roi;
+		struct {
+			uint32_t factor;
+			uint32_t count;
+		} decimation;
+		bool polarity;
+		struct {
+			caerFilterChainEventCallback function;
+			void *userData;
+		} callback;
+	} params;
+};
+
+struct caer_filter_chain {
+	size_t stagesSize;
+	size_t stagesCapacity;
+	struct filter_chain_stage *stages;
+};
+
+static struct filter_chain_stage *filterChainAddStage(caerFilterChain filterChain, enum filter_chain_stage_type type);
+
+caerFilterChain caerFilterChainInitialize(void) {
+	return (calloc(1, sizeof(struct caer_filter_chain)));
+}
+
+void caerFilterChainDestroy(caerFilterChain filterChain) {
+	if (filterChain->stages != NULL) {
+		free(filterChain->stages);
+	}
+
+	free(filterChain);
+}
+
+void caerFilterChainApply(caerFilterChain filterChain, caerPolarityEventPacket polarity) {
+	// Nothing to process.
+	if ((polarity == NULL) || (caerEventPacketHeaderGetEventValid(&polarity->packetHeader) == 0)
+		|| (filterChain->stagesSize == 0)) {
+		return;
+	}
+
+	// Packet-level setup for stages that need it.
+	for (size_t i = 0; i < filterChain->stagesSize; i++) {
+		if (filterChain->stages[i].type == STAGE_DVS_NOISE) {
+			filterDVSNoisePacketStart(filterChain->stages[i].params.noiseFilter, polarity);
+		}
+	}
+
+	CAER_POLARITY_ITERATOR_VALID_START(polarity)
+	for (size_t i = 0; i < filterChain->stagesSize; i++) {
+		struct filter_chain_stage *stage = &filterChain->stages[i];
+		bool pass                        = true;
+
+		// Decode from the event at each stage, callbacks may have changed it.
+		switch (stage->type) {
+			case STAGE_DVS_NOISE:
+				pass = filterDVSNoiseEvent(stage->params.noiseFilter,
+					caerPolarityEventGetX(caerPolarityIteratorElement),
+					caerPolarityEventGetY(caerPolarityIteratorElement),
+					caerPolarityEventGetPolarity(caerPolarityIteratorElement),
+					caerPolarityEventGetTimestamp64(caerPolarityIteratorElement, polarity));
+				break;
+
+			case STAGE_DVS_SPATIAL:
+				pass = filterDVSSpatialEvent(stage->params.spatialFilter, caerPolarityIteratorElement);
+				break;
+
+			case STAGE_ROI: {
+				uint16_t x = caerPolarityEventGetX(caerPolarityIteratorElement);
+				uint16_t y = caerPolarityEventGetY(caerPolarityIteratorElement);
+
+				pass = (x >= stage->params.roi.startX) && (x <= stage->params.roi.endX)
+					   && (y >= stage->params.roi.startY) && (y <= stage->params.roi.endY);
+				break;
+			}
+
+			case STAGE_DECIMATION:
+				stage->params.decimation.count++;
+
+				if (stage->params.decimation.count >= stage->params.decimation.factor) {
+					stage->params.decimation.count = 0;
+				}
+				else {
+					pass = false;
+				}
+				break;
+
+			case STAGE_POLARITY_SELECT:
+				pass = (caerPolarityEventGetPolarity(caerPolarityIteratorElement) == stage->params.polarity);
+				break;
+
+			case STAGE_CALLBACK:
+				pass = (*stage->params.callback.function)(
+					caerPolarityIteratorElement, polarity, stage->params.callback.userData);
+				break;
+		}
+
+		if (!pass) {
+			// Dropped: invalidate once and skip all following stages.
+			caerPolarityEventInvalidate(caerPolarityIteratorElement, polarity);
+			stage->dropped++;
+			break;
+		}
+	}
+	CAER_POLARITY_ITERATOR_VALID_END
+}
+
+size_t caerFilterChainGetStagesNumber(caerFilterChain filterChain) {
+	return (filterChain->stagesSize);
+}
+
+uint64_t caerFilterChainGetStageDropped(caerFilterChain filterChain, size_t stage) {
+	if (stage >= filterChain->stagesSize) {
+		return (0);
+	}
+
+	return (filterChain->stages[stage].dropped);
+}
+
+bool caerFilterChainAddDVSNoise(caerFilterChain filterChain, caerFilterDVSNoise noiseFilter) {
+	if (noiseFilter == NULL) {
+		return (false);
+	}
+
+	struct filter_chain_stage *stage = filterChainAddStage(filterChain, STAGE_DVS_NOISE);
+	if (stage == NULL) {
+		return (false);
+	}
+
+	stage->params.noiseFilter = noiseFilter;
+
+	return (true);
+}
+
+bool caerFilterChainAddDVSSpatial(caerFilterChain filterChain, caerFilterDVSSpatial spatialFilter) {
+	if (spatialFilter == NULL) {
+		return (false);
+	}
+
+	struct filter_chain_stage *stage = filterChainAddStage(filterChain, STAGE_DVS_SPATIAL);
+	if (stage == NULL) {
+		return (false);
+	}
+
+	stage->params.spatialFilter = spatialFilter;
+
+	return (true);
+}
+
+bool caerFilterChainAddROI(
+	caerFilterChain filterChain, uint16_t startX, uint16_t startY, uint16_t endX, uint16_t endY) {
+	if ((startX > endX) || (startY > endY)) {
+		return (false);
+	}
+
+	struct filter_chain_stage *stage = filterChainAddStage(filterChain, STAGE_ROI);
+	if (stage == NULL) {
+		return (false);
+	}
+
+	stage->params.roi.startX = startX;
+	stage->params.roi.startY = startY;
+	stage->params.roi.endX   = endX;
+	stage->params.roi.endY   = endY;
+
+	return (true);
+}
+
+bool caerFilterChainAddDecimation(caerFilterChain filterChain, uint32_t factor) {
+	struct filter_chain_stage *stage = filterChainAddStage(filterChain, STAGE_DECIMATION);
+	if (stage == NULL) {
+		return (false);
+	}
+
+	stage->params.decimation.factor = factor;
+	stage->params.decimation.count  = 0;
+
+	return (true);
+}
+
+bool caerFilterChainAddPolaritySelect(caerFilterChain filterChain, bool polarity) {
+	struct filter_chain_stage *stage = filterChainAddStage(filterChain, STAGE_POLARITY_SELECT);
+	if (stage == NULL) {
+		return (false);
+	}
+
+	stage->params.polarity = polarity;
+
+	return (true);
+}
+
+bool caerFilterChainAddCallback(caerFilterChain filterChain, caerFilterChainEventCallback callback, void *userData) {
+	if (callback == NULL) {
+		return (false);
+	}
+
+	struct filter_chain_stage *stage = filterChainAddStage(filterChain, STAGE_CALLBACK);
+	if (stage == NULL) {
+		return (false);
+	}
+
+	stage->params.callback.function = callback;
+	stage->params.callback.userData = userData;
+
+	return (true);
+}
+
+static struct filter_chain_stage *filterChainAddStage(caerFilterChain filterChain, enum filter_chain_stage_type type) {
+	if (filterChain->stagesSize == filterChain->stagesCapacity) {
+		size_t newCapacity = (filterChain->stagesCapacity == 0) ? (4) : (filterChain->stagesCapacity * 2);
+
+		struct filter_chain_stage *newStages
+			= realloc(filterChain->stages, newCapacity * sizeof(struct filter_chain_stage));
+		if (newStages == NULL) {
+			caerLog(CAER_LOG_ERROR, "Filter Chain", "Failed to allocate memory for new stage.");
+			return (NULL);
+		}
+
+		filterChain->stages         = newStages;
+		filterChain->stagesCapacity = newCapacity;
+	}
+
+	struct filter_chain_stage *stage = &filterChain->stages[filterChain->stagesSize++];
+	memset(stage, 0, sizeof(struct filter_chain_stage));
+
+	stage->type = type;
+
+	return (stage);
+}
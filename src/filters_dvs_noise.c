@@ -1,4 +1,6 @@
-#include "libcaer/filters/dvs_noise.h"
+#include "filters_dvs_noise.h"
+
+#include <math.h>
 
 struct caer_filter_dvs_noise {
 	// Logging support.
@@ -10,9 +12,18 @@ struct caer_filter_dvs_noise {
 	bool hotPixelLearningStarted;
 	int64_t hotPixelLearningStartTime;
 	uint32_t *hotPixelLearningMap;
+	// Hot Pixel filter (continuous learning).
+	bool hotPixelContinuous;
+	bool hotPixelContinuousStarted;
+	uint8_t hotPixelContinuousEpoch;
+	uint8_t hotPixelContinuousEpochsSinceRefresh;
+	int64_t hotPixelContinuousNextTime;
+	uint32_t *hotPixelRateMap;
+	uint8_t *hotPixelSetMap;
 	// Hot Pixel filter (filtering).
 	bool hotPixelEnabled;
 	size_t hotPixelArraySize;
+	size_t hotPixelArrayCapacity;
 	struct caer_filter_dvs_pixel *hotPixelArray;
 	uint64_t hotPixelStatOn;
 	uint64_t hotPixelStatOff;
@@ -30,7 +41,21 @@ struct caer_filter_dvs_noise {
 	uint32_t refractoryPeriodTime;
 	uint64_t refractoryPeriodStatOn;
 	uint64_t refractoryPeriodStatOff;
+	// Rate Limiter.
+	bool rateLimitEnabled;
+	bool rateLimitStarted;
+	uint32_t rateLimitTarget;
+	uint32_t rateLimitWindow;
+	uint32_t rateLimitPeriod;
+	int64_t rateLimitWindowStart;
+	uint64_t rateLimitWindowPassed;
+	uint64_t rateLimitStatOn;
+	uint64_t rateLimitStatOff;
+	// Last passed event per pixel: the timestamps map also records the
+	// events dropped by the Rate Limiter, which must not extend the period.
+	int64_t *rateLimitMap;
 	// Maps and their sizes.
+	bool timestampsMapRebase;
 	uint16_t sizeX;
 	uint16_t sizeY;
 	int64_t timestampsMap[];
@@ -45,10 +70,54 @@ struct dvs_pixel_with_count {
 #define GET_POL(X)         ((X) &0x01)
 #define SET_TSPOL(TS, POL) (((TS) << 1) | ((POL) &0x01))
 
+// Continuous hot pixel learning: each pixel has a 32bit rate entry, with the
+// upper 8 bits being the epoch (decay window) it was last updated in, and the
+// lower 24 bits being the event count, halved once for every elapsed epoch.
+#define HOTPIXEL_RATE_EPOCH(X)           U8T((X) >> 24)
+#define HOTPIXEL_RATE_COUNT(X)           ((X) &0x00FFFFFF)
+#define HOTPIXEL_RATE_PACK(EPOCH, COUNT) ((U32T(EPOCH) << 24) | ((COUNT) &0x00FFFFFF))
+#define HOTPIXEL_RATE_COUNT_MAX          0x00FFFFFF
+#define HOTPIXEL_RATE_DECAY_MAX_EPOCHS   24
+// Re-tag all rate entries periodically, so the 8bit epoch can never wrap
+// around for pixels that stay inactive for a long time.
+#define HOTPIXEL_RATE_REFRESH_EPOCHS 128
+
+// Bitmap of the pixels currently in the hot pixels set, for O(1) lookup.
+#define HOTPIXEL_SET_GET(MAP, IDX)   (((MAP)[(IDX) >> 3] >> ((IDX) &0x07)) & 0x01)
+#define HOTPIXEL_SET_SET(MAP, IDX)   ((MAP)[(IDX) >> 3] |= U8T(0x01 << ((IDX) &0x07)))
+#define HOTPIXEL_SET_CLEAR(MAP, IDX) ((MAP)[(IDX) >> 3] &= U8T(~(0x01 << ((IDX) &0x07))))
+
+// Saved filter state file format, all values are little-endian:
+// magic, version, sizeX, sizeY, flags (uint16_t each after the magic),
+// number of hot pixels (uint32_t), hot pixels (X and Y, uint16_t each),
+// and optionally the timestamps map as uint32_t values of (age << 1 | polarity).
+#define STATE_FILE_MAGIC             "CAERDVSN"
+#define STATE_FILE_MAGIC_LENGTH      8
+#define STATE_FILE_VERSION           1
+#define STATE_FILE_FLAG_TIMESTAMPS   0x0001
+#define STATE_FILE_TIMESTAMP_AGE_MAX 0x7FFFFFFF
+
+// Rate Limiter: bounds for the adaptive refractory period (in µs), and for
+// how much it can change in one window, to avoid oscillations.
+#define RATE_LIMIT_PERIOD_MIN    8
+#define RATE_LIMIT_PERIOD_MAX    1000000
+#define RATE_LIMIT_STEP_UP_MAX   2.0
+#define RATE_LIMIT_STEP_DOWN_MAX 0.5
+
 static void filterDVSNoiseLog(enum caer_log_level logLevel, caerFilterDVSNoise handle, const char *format, ...)
 	ATTRIBUTE_FORMAT(3);
 static int hotPixelArrayCountCompare(const void *a, const void *b);
 static void hotPixelGenerateArray(caerFilterDVSNoise noiseFilter);
+static bool hotPixelContinuousStart(caerFilterDVSNoise noiseFilter, int64_t startTime);
+static void hotPixelContinuousStop(caerFilterDVSNoise noiseFilter);
+static void hotPixelContinuousAdvance(caerFilterDVSNoise noiseFilter, int64_t timestamp);
+static void hotPixelContinuousAdd(caerFilterDVSNoise noiseFilter, size_t pixelIndex);
+static void hotPixelContinuousSyncSet(caerFilterDVSNoise noiseFilter);
+static void rateLimitAdvance(caerFilterDVSNoise noiseFilter, int64_t timestamp);
+static bool stateFileWrite(FILE *file, const void *data, size_t size);
+static bool stateFileRead(FILE *file, void *data, size_t size);
+static inline bool filterDVSNoiseEventInternal(
+	caerFilterDVSNoise noiseFilter, uint16_t x, uint16_t y, bool pol, int64_t ts);
 static void caerFilterDVSNoiseApplyInternal(
 	caerFilterDVSNoise noiseFilter, caerPolarityEventPacket polarityPacket, bool statisticsOnly);
 
@@ -89,6 +158,8 @@ caerFilterDVSNoise caerFilterDVSNoiseInitialize(uint16_t sizeX, uint16_t sizeY)
 	noiseFilter->backgroundActivitySupportMin    = 1;       // At least one pixel must support.
 	noiseFilter->backgroundActivitySupportMax    = 8;       // At most eight pixels can support.
 	noiseFilter->backgroundActivityTime          = 2000;    // 2 milliseconds within neighborhood.
+	noiseFilter->rateLimitTarget                 = 1000000; // 1 MEvt/s.
+	noiseFilter->rateLimitWindow                 = 10000;   // Adapt every 10 milliseconds.
 
 	return (noiseFilter);
 }
@@ -249,6 +320,14 @@ void caerFilterDVSNoiseDestroy(caerFilterDVSNoise noiseFilter) {
 		free(noiseFilter->hotPixelArray);
 	}
 
+	// And continuous learning maps.
+	hotPixelContinuousStop(noiseFilter);
+
+	// And the Rate Limiter map.
+	if (noiseFilter->rateLimitMap != NULL) {
+		free(noiseFilter->rateLimitMap);
+	}
+
 	free(noiseFilter);
 }
 
@@ -271,6 +350,35 @@ static void caerFilterDVSNoiseApplyInternal(
 		return;
 	}
 
+	filterDVSNoisePacketStart(noiseFilter, polarityPacket);
+
+	CAER_POLARITY_ITERATOR_VALID_START(polarityPacket)
+	uint16_t x = caerPolarityEventGetX(caerPolarityIteratorElement);
+	uint16_t y = caerPolarityEventGetY(caerPolarityIteratorElement);
+	bool pol   = caerPolarityEventGetPolarity(caerPolarityIteratorElement);
+	int64_t ts = caerPolarityEventGetTimestamp64(caerPolarityIteratorElement, polarityPacket);
+
+	if (!filterDVSNoiseEventInternal(noiseFilter, x, y, pol, ts) && !statisticsOnly) {
+		caerPolarityEventInvalidate(caerPolarityIteratorElement, polarityPacket);
+	}
+	CAER_POLARITY_ITERATOR_VALID_END
+}
+
+void filterDVSNoisePacketStart(caerFilterDVSNoise noiseFilter, caerPolarityEventPacketConst polarityPacket) {
+	// Timestamps map loaded from a saved state: move it to the current timebase.
+	if (noiseFilter->timestampsMapRebase) {
+		caerPolarityEventConst firstEvent = caerPolarityEventPacketGetEventConst(polarityPacket, 0);
+		int64_t rebase = caerPolarityEventGetTimestamp64(firstEvent, polarityPacket) * 2; // Skip polarity bit.
+
+		size_t pixelNumber = (size_t) noiseFilter->sizeX * (size_t) noiseFilter->sizeY;
+
+		for (size_t i = 0; i < pixelNumber; i++) {
+			noiseFilter->timestampsMap[i] += rebase;
+		}
+
+		noiseFilter->timestampsMapRebase = false;
+	}
+
 	// Hot Pixel learning: initialize and store packet-level timestamp.
 	if (noiseFilter->hotPixelLearn && !noiseFilter->hotPixelLearningStarted) {
 		// Initialize hot pixel learning.
@@ -293,12 +401,35 @@ static void caerFilterDVSNoiseApplyInternal(
 		}
 	}
 
-	CAER_POLARITY_ITERATOR_VALID_START(polarityPacket)
-	uint16_t x        = caerPolarityEventGetX(caerPolarityIteratorElement);
-	uint16_t y        = caerPolarityEventGetY(caerPolarityIteratorElement);
-	bool pol          = caerPolarityEventGetPolarity(caerPolarityIteratorElement);
-	int64_t ts        = caerPolarityEventGetTimestamp64(caerPolarityIteratorElement, polarityPacket);
+	// Hot Pixel continuous learning: allocate maps and start decay epochs.
+	if (noiseFilter->hotPixelContinuous && !noiseFilter->hotPixelContinuousStarted) {
+		caerPolarityEventConst firstEvent = caerPolarityEventPacketGetEventConst(polarityPacket, 0);
+
+		if (!hotPixelContinuousStart(noiseFilter, caerPolarityEventGetTimestamp64(firstEvent, polarityPacket))) {
+			filterDVSNoiseLog(
+				CAER_LOG_ERROR, noiseFilter, "HotPixel Continuous: failed to allocate memory for rate maps.");
+			noiseFilter->hotPixelContinuous = false; // Disable continuous learning on failure.
+		}
+	}
+
+	// Rate Limiter: allocate map of last passed events.
+	if (noiseFilter->rateLimitEnabled && (noiseFilter->rateLimitMap == NULL)) {
+		noiseFilter->rateLimitMap = calloc((size_t) noiseFilter->sizeX * (size_t) noiseFilter->sizeY, sizeof(int64_t));
+		if (noiseFilter->rateLimitMap == NULL) {
+			filterDVSNoiseLog(CAER_LOG_ERROR, noiseFilter, "Rate Limiter: failed to allocate memory for map.");
+			noiseFilter->rateLimitEnabled = false; // Disable rate limiting on failure.
+		}
+	}
+}
+
+bool filterDVSNoiseEvent(caerFilterDVSNoise noiseFilter, uint16_t x, uint16_t y, bool pol, int64_t ts) {
+	return (filterDVSNoiseEventInternal(noiseFilter, x, y, pol, ts));
+}
+
+static inline bool filterDVSNoiseEventInternal(
+	caerFilterDVSNoise noiseFilter, uint16_t x, uint16_t y, bool pol, int64_t ts) {
 	size_t pixelIndex = (y * (size_t) noiseFilter->sizeX) + x; // Target pixel.
+	bool valid        = true;
 
 	// Hot Pixel learning: determine which pixels are abnormally active,
 	// by counting how many times they spike in a given time period. The
@@ -320,6 +451,35 @@ static void caerFilterDVSNoiseApplyInternal(
 			noiseFilter->hotPixelLearn           = false;
 
 			filterDVSNoiseLog(CAER_LOG_DEBUG, noiseFilter, "HotPixel Learning: completed on ts=%" PRIi64 ".", ts);
+
+			// Continuous learning keeps going from the newly learned set.
+			if (noiseFilter->hotPixelContinuousStarted) {
+				hotPixelContinuousSyncSet(noiseFilter);
+			}
+		}
+	}
+
+	// Hot Pixel continuous learning: update the decayed activity estimate of
+	// this pixel, and add it to the hot pixels set right away if it crosses
+	// the threshold. Removal from the set happens at the end of each epoch.
+	if (noiseFilter->hotPixelContinuousStarted) {
+		if (ts >= noiseFilter->hotPixelContinuousNextTime) {
+			hotPixelContinuousAdvance(noiseFilter, ts);
+		}
+
+		uint8_t epoch  = noiseFilter->hotPixelContinuousEpoch;
+		uint32_t rate  = noiseFilter->hotPixelRateMap[pixelIndex];
+		uint8_t decay  = U8T(epoch - HOTPIXEL_RATE_EPOCH(rate));
+		uint32_t count = (decay >= HOTPIXEL_RATE_DECAY_MAX_EPOCHS) ? (0) : (HOTPIXEL_RATE_COUNT(rate) >> decay);
+
+		if (count < HOTPIXEL_RATE_COUNT_MAX) {
+			count++;
+		}
+
+		noiseFilter->hotPixelRateMap[pixelIndex] = HOTPIXEL_RATE_PACK(epoch, count);
+
+		if ((count >= noiseFilter->hotPixelCount) && !HOTPIXEL_SET_GET(noiseFilter->hotPixelSetMap, pixelIndex)) {
+			hotPixelContinuousAdd(noiseFilter, pixelIndex);
 		}
 	}
 
@@ -327,28 +487,30 @@ static void caerFilterDVSNoiseApplyInternal(
 	if (noiseFilter->hotPixelEnabled) {
 		bool filteredOut = false;
 
-		for (size_t i = 0; i < noiseFilter->hotPixelArraySize; i++) {
-			if ((x == noiseFilter->hotPixelArray[i].x) && (y == noiseFilter->hotPixelArray[i].y)) {
-				if (!statisticsOnly) {
-					caerPolarityEventInvalidate(caerPolarityIteratorElement, polarityPacket);
-				}
-				if (pol) {
-					noiseFilter->hotPixelStatOn++;
-				}
-				else {
-					noiseFilter->hotPixelStatOff++;
+		if (noiseFilter->hotPixelContinuousStarted) {
+			filteredOut = HOTPIXEL_SET_GET(noiseFilter->hotPixelSetMap, pixelIndex);
+		}
+		else {
+			for (size_t i = 0; i < noiseFilter->hotPixelArraySize; i++) {
+				if ((x == noiseFilter->hotPixelArray[i].x) && (y == noiseFilter->hotPixelArray[i].y)) {
+					filteredOut = true;
+					break;
 				}
-
-				filteredOut = true;
-				break;
 			}
 		}
 
 		if (filteredOut) {
-			// Go to next event, don't execute other filters and don't
-			// update timestamps map. Hot pixels don't provide any useful
-			// timing information, as they are repeating noise.
-			continue;
+			if (pol) {
+				noiseFilter->hotPixelStatOn++;
+			}
+			else {
+				noiseFilter->hotPixelStatOff++;
+			}
+
+			// Don't execute other filters and don't update timestamps
+			// map. Hot pixels don't provide any useful timing information,
+			// as they are repeating noise.
+			return (false);
 		}
 	}
 
@@ -357,9 +519,6 @@ static void caerFilterDVSNoiseApplyInternal(
 	// can we try to eliminate the event early in a less costly manner.
 	if (noiseFilter->refractoryPeriodEnabled) {
 		if ((ts - GET_TS(noiseFilter->timestampsMap[pixelIndex])) < noiseFilter->refractoryPeriodTime) {
-			if (!statisticsOnly) {
-				caerPolarityEventInvalidate(caerPolarityIteratorElement, polarityPacket);
-			}
 			if (pol) {
 				noiseFilter->refractoryPeriodStatOn++;
 			}
@@ -367,6 +526,7 @@ static void caerFilterDVSNoiseApplyInternal(
 				noiseFilter->refractoryPeriodStatOff++;
 			}
 
+			valid = false;
 			goto WriteTimestamp;
 		}
 	}
@@ -398,11 +558,8 @@ static void caerFilterDVSNoiseApplyInternal(
 		}
 
 		// Event is not supported by any neighbor if we get here, invalidate it.
-		// Then jump over the Refractory Period filter, as it's useless to
-		// execute it (and would cause a double-invalidate error).
-		if (!statisticsOnly) {
-			caerPolarityEventInvalidate(caerPolarityIteratorElement, polarityPacket);
-		}
+		valid = false;
+
 		if (pol) {
 			noiseFilter->backgroundActivityStatOn++;
 		}
@@ -412,10 +569,41 @@ static void caerFilterDVSNoiseApplyInternal(
 	}
 
 WriteTimestamp:
+	// Rate Limiter: like the Refractory Period filter, but with a period
+	// adapted to the overall output rate, see rateLimitAdvance(), and
+	// measured from the last event passed, so that fast pixels are thinned
+	// out to one event per period, instead of being blocked.
+	if (valid && noiseFilter->rateLimitEnabled) {
+		if (!noiseFilter->rateLimitStarted) {
+			noiseFilter->rateLimitStarted      = true;
+			noiseFilter->rateLimitWindowStart  = ts;
+			noiseFilter->rateLimitWindowPassed = 0;
+		}
+		else if (ts >= (noiseFilter->rateLimitWindowStart + noiseFilter->rateLimitWindow)) {
+			rateLimitAdvance(noiseFilter, ts);
+		}
+
+		if ((ts - noiseFilter->rateLimitMap[pixelIndex]) < noiseFilter->rateLimitPeriod) {
+			if (pol) {
+				noiseFilter->rateLimitStatOn++;
+			}
+			else {
+				noiseFilter->rateLimitStatOff++;
+			}
+
+			valid = false;
+		}
+		else {
+			noiseFilter->rateLimitMap[pixelIndex] = ts;
+			noiseFilter->rateLimitWindowPassed++;
+		}
+	}
+
 	// Update pixel timestamp (one write). Always update so filters are
 	// ready at enable-time right away.
 	noiseFilter->timestampsMap[pixelIndex] = SET_TSPOL(ts, pol);
-	CAER_POLARITY_ITERATOR_VALID_END
+
+	return (valid);
 }
 
 bool caerFilterDVSNoiseConfigSet(caerFilterDVSNoise noiseFilter, uint8_t paramAddr, uint64_t param) {
@@ -436,6 +624,15 @@ bool caerFilterDVSNoiseConfigSet(caerFilterDVSNoise noiseFilter, uint8_t paramAd
 			noiseFilter->hotPixelEnabled = param;
 			break;
 
+		case CAER_FILTER_DVS_HOTPIXEL_CONTINUOUS:
+			noiseFilter->hotPixelContinuous = param;
+
+			// Learned hot pixels set is kept, only the rate maps go away.
+			if (!noiseFilter->hotPixelContinuous) {
+				hotPixelContinuousStop(noiseFilter);
+			}
+			break;
+
 		case CAER_FILTER_DVS_BACKGROUND_ACTIVITY_ENABLE:
 			noiseFilter->backgroundActivityEnabled = param;
 			break;
@@ -468,6 +665,36 @@ bool caerFilterDVSNoiseConfigSet(caerFilterDVSNoise noiseFilter, uint8_t paramAd
 			noiseFilter->refractoryPeriodTime = U32T(param);
 			break;
 
+		case CAER_FILTER_DVS_RATE_LIMIT_ENABLE:
+			noiseFilter->rateLimitEnabled = param;
+
+			// Start adapting again from no limit.
+			noiseFilter->rateLimitStarted = false;
+			noiseFilter->rateLimitPeriod  = 0;
+
+			// Map is allocated again on the next packet, if enabled.
+			if (!noiseFilter->rateLimitEnabled && (noiseFilter->rateLimitMap != NULL)) {
+				free(noiseFilter->rateLimitMap);
+				noiseFilter->rateLimitMap = NULL;
+			}
+			break;
+
+		case CAER_FILTER_DVS_RATE_LIMIT_TARGET:
+			if (param == 0) {
+				return (false);
+			}
+
+			noiseFilter->rateLimitTarget = U32T(param);
+			break;
+
+		case CAER_FILTER_DVS_RATE_LIMIT_WINDOW:
+			if (param == 0) {
+				return (false);
+			}
+
+			noiseFilter->rateLimitWindow = U32T(param);
+			break;
+
 		case CAER_FILTER_DVS_LOG_LEVEL:
 			noiseFilter->logLevel = U8T(param);
 			break;
@@ -475,14 +702,31 @@ bool caerFilterDVSNoiseConfigSet(caerFilterDVSNoise noiseFilter, uint8_t paramAd
 		case CAER_FILTER_DVS_RESET:
 			if (param) {
 				// Reset hot pixel list and timestamp map.
-				noiseFilter->hotPixelArraySize = 0;
+				noiseFilter->hotPixelArraySize     = 0;
+				noiseFilter->hotPixelArrayCapacity = 0;
 				if (noiseFilter->hotPixelArray != NULL) {
 					free(noiseFilter->hotPixelArray);
 					noiseFilter->hotPixelArray = NULL;
 				}
 
+				if (noiseFilter->hotPixelContinuousStarted) {
+					size_t pixelNumber = (size_t) noiseFilter->sizeX * (size_t) noiseFilter->sizeY;
+
+					memset(noiseFilter->hotPixelRateMap, 0, pixelNumber * sizeof(uint32_t));
+					memset(noiseFilter->hotPixelSetMap, 0, (pixelNumber + 7) / 8);
+
+					noiseFilter->hotPixelContinuousEpoch              = 0;
+					noiseFilter->hotPixelContinuousEpochsSinceRefresh = 0;
+				}
+
 				memset(noiseFilter->timestampsMap, 0,
 					(size_t) noiseFilter->sizeX * (size_t) noiseFilter->sizeY * sizeof(int64_t));
+				noiseFilter->timestampsMapRebase = false;
+
+				if (noiseFilter->rateLimitMap != NULL) {
+					memset(noiseFilter->rateLimitMap, 0,
+						(size_t) noiseFilter->sizeX * (size_t) noiseFilter->sizeY * sizeof(int64_t));
+				}
 
 				// Reset statistics to zero
 				noiseFilter->hotPixelStatOn            = 0;
@@ -491,6 +735,11 @@ bool caerFilterDVSNoiseConfigSet(caerFilterDVSNoise noiseFilter, uint8_t paramAd
 				noiseFilter->backgroundActivityStatOff = 0;
 				noiseFilter->refractoryPeriodStatOn    = 0;
 				noiseFilter->refractoryPeriodStatOff   = 0;
+				noiseFilter->rateLimitStatOn           = 0;
+				noiseFilter->rateLimitStatOff          = 0;
+
+				noiseFilter->rateLimitStarted = false;
+				noiseFilter->rateLimitPeriod  = 0;
 			}
 			break;
 
@@ -524,6 +773,10 @@ bool caerFilterDVSNoiseConfigGet(caerFilterDVSNoise noiseFilter, uint8_t paramAd
 			*param = noiseFilter->hotPixelEnabled;
 			break;
 
+		case CAER_FILTER_DVS_HOTPIXEL_CONTINUOUS:
+			*param = noiseFilter->hotPixelContinuous;
+			break;
+
 		case CAER_FILTER_DVS_HOTPIXEL_STATISTICS:
 			*param = (noiseFilter->hotPixelStatOn + noiseFilter->hotPixelStatOff);
 			break;
@@ -592,6 +845,34 @@ bool caerFilterDVSNoiseConfigGet(caerFilterDVSNoise noiseFilter, uint8_t paramAd
 			*param = noiseFilter->refractoryPeriodStatOff;
 			break;
 
+		case CAER_FILTER_DVS_RATE_LIMIT_ENABLE:
+			*param = noiseFilter->rateLimitEnabled;
+			break;
+
+		case CAER_FILTER_DVS_RATE_LIMIT_TARGET:
+			*param = noiseFilter->rateLimitTarget;
+			break;
+
+		case CAER_FILTER_DVS_RATE_LIMIT_WINDOW:
+			*param = noiseFilter->rateLimitWindow;
+			break;
+
+		case CAER_FILTER_DVS_RATE_LIMIT_PERIOD:
+			*param = noiseFilter->rateLimitPeriod;
+			break;
+
+		case CAER_FILTER_DVS_RATE_LIMIT_STATISTICS:
+			*param = (noiseFilter->rateLimitStatOn + noiseFilter->rateLimitStatOff);
+			break;
+
+		case CAER_FILTER_DVS_RATE_LIMIT_STATISTICS_ON:
+			*param = noiseFilter->rateLimitStatOn;
+			break;
+
+		case CAER_FILTER_DVS_RATE_LIMIT_STATISTICS_OFF:
+			*param = noiseFilter->rateLimitStatOff;
+			break;
+
 		case CAER_FILTER_DVS_LOG_LEVEL:
 			*param = noiseFilter->logLevel;
 			break;
@@ -620,13 +901,318 @@ ssize_t caerFilterDVSNoiseGetHotPixels(caerFilterDVSNoise noiseFilter, caerFilte
 		return (-1);
 	}
 
-	// Copy pixel array over.
-	memcpy(
-		*hotPixels, noiseFilter->hotPixelArray, noiseFilter->hotPixelArraySize * sizeof(struct caer_filter_dvs_pixel));
+	if (!noiseFilter->hotPixelContinuousStarted) {
+		// Copy pixel array over.
+		memcpy(*hotPixels, noiseFilter->hotPixelArray,
+			noiseFilter->hotPixelArraySize * sizeof(struct caer_filter_dvs_pixel));
+
+		return ((ssize_t) noiseFilter->hotPixelArraySize);
+	}
+
+	// Continuous learning keeps the set in insertion order, sort only
+	// the copy by current activity.
+	struct dvs_pixel_with_count *sortPixels
+		= malloc(noiseFilter->hotPixelArraySize * sizeof(struct dvs_pixel_with_count));
+	if (sortPixels == NULL) {
+		// Memory allocation failure.
+		free(*hotPixels);
+		*hotPixels = NULL;
+
+		return (-1);
+	}
+
+	for (size_t i = 0; i < noiseFilter->hotPixelArraySize; i++) {
+		size_t pixelIndex = (noiseFilter->hotPixelArray[i].y * (size_t) noiseFilter->sizeX)
+							+ noiseFilter->hotPixelArray[i].x;
+		uint32_t rate = noiseFilter->hotPixelRateMap[pixelIndex];
+		uint8_t decay = U8T(noiseFilter->hotPixelContinuousEpoch - HOTPIXEL_RATE_EPOCH(rate));
+
+		sortPixels[i].address = noiseFilter->hotPixelArray[i];
+		sortPixels[i].count
+			= (decay >= HOTPIXEL_RATE_DECAY_MAX_EPOCHS) ? (0) : (HOTPIXEL_RATE_COUNT(rate) >> decay);
+	}
+
+	qsort(sortPixels, noiseFilter->hotPixelArraySize, sizeof(struct dvs_pixel_with_count), &hotPixelArrayCountCompare);
+
+	// Sorted ascending, copy back in reverse for most active first.
+	for (size_t i = 0; i < noiseFilter->hotPixelArraySize; i++) {
+		(*hotPixels)[i] = sortPixels[noiseFilter->hotPixelArraySize - 1 - i].address;
+	}
+
+	free(sortPixels);
 
 	return ((ssize_t) noiseFilter->hotPixelArraySize);
 }
 
+bool caerFilterDVSNoiseStateSave(caerFilterDVSNoise noiseFilter, const char *fileName, bool saveTimestamps) {
+	size_t pixelNumber = (size_t) noiseFilter->sizeX * (size_t) noiseFilter->sizeY;
+
+	// Prepare timestamps map first, as relative ages to the most recent timestamp.
+	uint32_t *timestampAges = NULL;
+
+	if (saveTimestamps) {
+		timestampAges = malloc(pixelNumber * sizeof(uint32_t));
+		if (timestampAges == NULL) {
+			filterDVSNoiseLog(CAER_LOG_ERROR, noiseFilter, "State Save: failed to allocate memory for timestamps.");
+			return (false);
+		}
+
+		int64_t lastTimestamp = INT64_MIN;
+
+		for (size_t i = 0; i < pixelNumber; i++) {
+			if (GET_TS(noiseFilter->timestampsMap[i]) > lastTimestamp) {
+				lastTimestamp = GET_TS(noiseFilter->timestampsMap[i]);
+			}
+		}
+
+		for (size_t i = 0; i < pixelNumber; i++) {
+			int64_t age = lastTimestamp - GET_TS(noiseFilter->timestampsMap[i]);
+			if (age > STATE_FILE_TIMESTAMP_AGE_MAX) {
+				age = STATE_FILE_TIMESTAMP_AGE_MAX;
+			}
+
+			timestampAges[i] = htole32((U32T(age) << 1) | U32T(GET_POL(noiseFilter->timestampsMap[i])));
+		}
+	}
+
+	FILE *file = fopen(fileName, "wb");
+	if (file == NULL) {
+		filterDVSNoiseLog(CAER_LOG_ERROR, noiseFilter, "State Save: failed to open file '%s' for writing. Error: %d.",
+			fileName, errno);
+		free(timestampAges);
+		return (false);
+	}
+
+	uint16_t header[4] = {htole16(STATE_FILE_VERSION), htole16(noiseFilter->sizeX), htole16(noiseFilter->sizeY),
+		htole16((saveTimestamps) ? (STATE_FILE_FLAG_TIMESTAMPS) : (0))};
+	uint32_t hotPixelsNumber = htole32(U32T(noiseFilter->hotPixelArraySize));
+
+	bool success = stateFileWrite(file, STATE_FILE_MAGIC, STATE_FILE_MAGIC_LENGTH)
+				   && stateFileWrite(file, header, sizeof(header))
+				   && stateFileWrite(file, &hotPixelsNumber, sizeof(hotPixelsNumber));
+
+	for (size_t i = 0; success && (i < noiseFilter->hotPixelArraySize); i++) {
+		uint16_t pixel[2] = {htole16(noiseFilter->hotPixelArray[i].x), htole16(noiseFilter->hotPixelArray[i].y)};
+
+		success = stateFileWrite(file, pixel, sizeof(pixel));
+	}
+
+	if (success && saveTimestamps) {
+		success = stateFileWrite(file, timestampAges, pixelNumber * sizeof(uint32_t));
+	}
+
+	free(timestampAges);
+
+	if ((fclose(file) != 0) || !success) {
+		filterDVSNoiseLog(CAER_LOG_ERROR, noiseFilter, "State Save: failed to write file '%s'.", fileName);
+		return (false);
+	}
+
+	filterDVSNoiseLog(CAER_LOG_DEBUG, noiseFilter, "State Save: saved %zu hot pixels%s to '%s'.",
+		noiseFilter->hotPixelArraySize, (saveTimestamps) ? (" and timestamps map") : (""), fileName);
+
+	return (true);
+}
+
+bool caerFilterDVSNoiseStateLoad(caerFilterDVSNoise noiseFilter, const char *fileName) {
+	size_t pixelNumber = (size_t) noiseFilter->sizeX * (size_t) noiseFilter->sizeY;
+
+	FILE *file = fopen(fileName, "rb");
+	if (file == NULL) {
+		filterDVSNoiseLog(CAER_LOG_ERROR, noiseFilter, "State Load: failed to open file '%s' for reading. Error: %d.",
+			fileName, errno);
+		return (false);
+	}
+
+	char magic[STATE_FILE_MAGIC_LENGTH];
+	uint16_t header[4];
+	uint32_t hotPixelsNumber;
+
+	if (!stateFileRead(file, magic, STATE_FILE_MAGIC_LENGTH) || !stateFileRead(file, header, sizeof(header))
+		|| !stateFileRead(file, &hotPixelsNumber, sizeof(hotPixelsNumber))) {
+		filterDVSNoiseLog(CAER_LOG_ERROR, noiseFilter, "State Load: failed to read header of file '%s'.", fileName);
+		fclose(file);
+		return (false);
+	}
+
+	hotPixelsNumber = le32toh(hotPixelsNumber);
+
+	if ((memcmp(magic, STATE_FILE_MAGIC, STATE_FILE_MAGIC_LENGTH) != 0)
+		|| (le16toh(header[0]) != STATE_FILE_VERSION)) {
+		filterDVSNoiseLog(CAER_LOG_ERROR, noiseFilter, "State Load: '%s' is not a valid state file.", fileName);
+		fclose(file);
+		return (false);
+	}
+
+	if ((le16toh(header[1]) != noiseFilter->sizeX) || (le16toh(header[2]) != noiseFilter->sizeY)) {
+		filterDVSNoiseLog(CAER_LOG_ERROR, noiseFilter,
+			"State Load: resolution mismatch, file has %" PRIu16 "x%" PRIu16 ", filter has %" PRIu16 "x%" PRIu16 ".",
+			le16toh(header[1]), le16toh(header[2]), noiseFilter->sizeX, noiseFilter->sizeY);
+		fclose(file);
+		return (false);
+	}
+
+	if (hotPixelsNumber > pixelNumber) {
+		filterDVSNoiseLog(CAER_LOG_ERROR, noiseFilter,
+			"State Load: file has %" PRIu32 " hot pixels, more than the %zu pixels of the sensor, '%s' is corrupt.",
+			hotPixelsNumber, pixelNumber, fileName);
+		fclose(file);
+		return (false);
+	}
+
+	bool loadTimestamps = (le16toh(header[3]) & STATE_FILE_FLAG_TIMESTAMPS);
+
+	// Read everything into temporary memory, only replace the current state
+	// if the whole file could be read successfully.
+	struct caer_filter_dvs_pixel *hotPixels = NULL;
+	uint32_t *timestampAges                 = NULL;
+
+	if (hotPixelsNumber > 0) {
+		hotPixels = malloc(hotPixelsNumber * sizeof(struct caer_filter_dvs_pixel));
+	}
+
+	if (loadTimestamps) {
+		timestampAges = malloc(pixelNumber * sizeof(uint32_t));
+	}
+
+	if (((hotPixelsNumber > 0) && (hotPixels == NULL)) || (loadTimestamps && (timestampAges == NULL))) {
+		filterDVSNoiseLog(CAER_LOG_ERROR, noiseFilter, "State Load: failed to allocate memory for state.");
+		free(hotPixels);
+		free(timestampAges);
+		fclose(file);
+		return (false);
+	}
+
+	bool success = true;
+
+	for (size_t i = 0; success && (i < hotPixelsNumber); i++) {
+		uint16_t pixel[2];
+
+		if (!stateFileRead(file, pixel, sizeof(pixel))) {
+			success = false;
+			break;
+		}
+
+		hotPixels[i].x = le16toh(pixel[0]);
+		hotPixels[i].y = le16toh(pixel[1]);
+
+		// Refuse out-of-range addresses, they would index outside the maps.
+		if ((hotPixels[i].x >= noiseFilter->sizeX) || (hotPixels[i].y >= noiseFilter->sizeY)) {
+			success = false;
+		}
+	}
+
+	if (success && loadTimestamps) {
+		success = stateFileRead(file, timestampAges, pixelNumber * sizeof(uint32_t));
+	}
+
+	fclose(file);
+
+	if (!success) {
+		filterDVSNoiseLog(CAER_LOG_ERROR, noiseFilter, "State Load: failed to read content of file '%s'.", fileName);
+		free(hotPixels);
+		free(timestampAges);
+		return (false);
+	}
+
+	// Replace hot pixels array.
+	if (noiseFilter->hotPixelArray != NULL) {
+		free(noiseFilter->hotPixelArray);
+	}
+
+	noiseFilter->hotPixelArray         = hotPixels;
+	noiseFilter->hotPixelArraySize     = hotPixelsNumber;
+	noiseFilter->hotPixelArrayCapacity = hotPixelsNumber;
+
+	if (noiseFilter->hotPixelContinuousStarted) {
+		hotPixelContinuousSyncSet(noiseFilter);
+	}
+
+	// Replace timestamps map. Ages are stored as negative timestamps now,
+	// the next packet will move them to its timebase.
+	if (loadTimestamps) {
+		for (size_t i = 0; i < pixelNumber; i++) {
+			uint32_t value = le32toh(timestampAges[i]);
+
+			noiseFilter->timestampsMap[i] = (-((int64_t) (value >> 1)) * 2) + (value & 0x01);
+		}
+
+		noiseFilter->timestampsMapRebase = true;
+
+		// Last passed events belong to the old timebase.
+		if (noiseFilter->rateLimitMap != NULL) {
+			memset(noiseFilter->rateLimitMap, 0, pixelNumber * sizeof(int64_t));
+		}
+
+		free(timestampAges);
+	}
+
+	filterDVSNoiseLog(CAER_LOG_DEBUG, noiseFilter, "State Load: loaded %" PRIu32 " hot pixels%s from '%s'.",
+		hotPixelsNumber, (loadTimestamps) ? (" and timestamps map") : (""), fileName);
+
+	return (true);
+}
+
+// Rate Limiter: at the end of each window, scale the refractory period with
+// the ratio between the measured output rate and the target rate. Longer
+// periods lower the output rate of the most active pixels first, so the
+// total output rate moves towards the target.
+static void rateLimitAdvance(caerFilterDVSNoise noiseFilter, int64_t timestamp) {
+	double elapsed = (double) (timestamp - noiseFilter->rateLimitWindowStart);
+	double rate    = ((double) noiseFilter->rateLimitWindowPassed * 1000000.0) / elapsed;
+	// Square root damps the adaptation: the output rate only settles about
+	// one period after a change, so full steps would overshoot and oscillate.
+	double ratio = sqrt(rate / (double) noiseFilter->rateLimitTarget);
+
+	if (ratio > RATE_LIMIT_STEP_UP_MAX) {
+		ratio = RATE_LIMIT_STEP_UP_MAX;
+	}
+	if (ratio < RATE_LIMIT_STEP_DOWN_MAX) {
+		ratio = RATE_LIMIT_STEP_DOWN_MAX;
+	}
+
+	double period = (double) noiseFilter->rateLimitPeriod;
+
+	if (ratio > 1.0) {
+		// Over target: start limiting from the minimum period.
+		if (period < RATE_LIMIT_PERIOD_MIN) {
+			period = RATE_LIMIT_PERIOD_MIN;
+		}
+
+		period *= ratio;
+
+		if (period > RATE_LIMIT_PERIOD_MAX) {
+			period = RATE_LIMIT_PERIOD_MAX;
+		}
+	}
+	else {
+		period *= ratio;
+
+		// Under target: stop limiting altogether once the period gets small.
+		if (period < RATE_LIMIT_PERIOD_MIN) {
+			period = 0;
+		}
+	}
+
+	if (U32T(period) != noiseFilter->rateLimitPeriod) {
+		filterDVSNoiseLog(CAER_LOG_DEBUG, noiseFilter,
+			"Rate Limiter: output rate %.0f ev/s, refractory period changed from %" PRIu32 " to %" PRIu32 " us.",
+			rate, noiseFilter->rateLimitPeriod, U32T(period));
+	}
+
+	noiseFilter->rateLimitPeriod       = U32T(period);
+	noiseFilter->rateLimitWindowStart  = timestamp;
+	noiseFilter->rateLimitWindowPassed = 0;
+}
+
+static bool stateFileWrite(FILE *file, const void *data, size_t size) {
+	return (fwrite(data, size, 1, file) == 1);
+}
+
+static bool stateFileRead(FILE *file, void *data, size_t size) {
+	return (fread(data, size, 1, file) == 1);
+}
+
 static int hotPixelArrayCountCompare(const void *a, const void *b) {
 	const struct dvs_pixel_with_count *aa = a;
 	const struct dvs_pixel_with_count *bb = b;
@@ -646,8 +1232,9 @@ static void hotPixelGenerateArray(caerFilterDVSNoise noiseFilter) {
 	// Remove old array, if present.
 	if (noiseFilter->hotPixelArray != NULL) {
 		free(noiseFilter->hotPixelArray);
-		noiseFilter->hotPixelArray     = NULL;
-		noiseFilter->hotPixelArraySize = 0;
+		noiseFilter->hotPixelArray         = NULL;
+		noiseFilter->hotPixelArraySize     = 0;
+		noiseFilter->hotPixelArrayCapacity = 0;
 	}
 
 	size_t pixelNumber = (size_t)(noiseFilter->sizeX * noiseFilter->sizeY);
@@ -691,10 +1278,160 @@ static void hotPixelGenerateArray(caerFilterDVSNoise noiseFilter) {
 	}
 
 	// Set size and fill array with pre-sorted data.
-	noiseFilter->hotPixelArraySize = hotPixelsNumber;
+	noiseFilter->hotPixelArraySize     = hotPixelsNumber;
+	noiseFilter->hotPixelArrayCapacity = hotPixelsNumber;
 
 	for (size_t i = 0; i < hotPixelsNumber; i++) {
 		noiseFilter->hotPixelArray[i].x = hotPixels[i].address.x;
 		noiseFilter->hotPixelArray[i].y = hotPixels[i].address.y;
 	}
 }
+
+static bool hotPixelContinuousStart(caerFilterDVSNoise noiseFilter, int64_t startTime) {
+	size_t pixelNumber = (size_t) noiseFilter->sizeX * (size_t) noiseFilter->sizeY;
+
+	noiseFilter->hotPixelRateMap = calloc(pixelNumber, sizeof(uint32_t));
+	if (noiseFilter->hotPixelRateMap == NULL) {
+		return (false);
+	}
+
+	noiseFilter->hotPixelSetMap = calloc((pixelNumber + 7) / 8, sizeof(uint8_t));
+	if (noiseFilter->hotPixelSetMap == NULL) {
+		free(noiseFilter->hotPixelRateMap);
+		noiseFilter->hotPixelRateMap = NULL;
+
+		return (false);
+	}
+
+	noiseFilter->hotPixelContinuousStarted            = true;
+	noiseFilter->hotPixelContinuousEpoch              = 0;
+	noiseFilter->hotPixelContinuousEpochsSinceRefresh = 0;
+	noiseFilter->hotPixelContinuousNextTime
+		= startTime + ((noiseFilter->hotPixelTime == 0) ? (1) : (noiseFilter->hotPixelTime));
+
+	// Start from any previously learned hot pixels.
+	hotPixelContinuousSyncSet(noiseFilter);
+
+	filterDVSNoiseLog(CAER_LOG_DEBUG, noiseFilter,
+		"HotPixel Continuous: started on ts=%" PRIi64 " with %zu hot pixels.", startTime,
+		noiseFilter->hotPixelArraySize);
+
+	return (true);
+}
+
+static void hotPixelContinuousStop(caerFilterDVSNoise noiseFilter) {
+	if (noiseFilter->hotPixelRateMap != NULL) {
+		free(noiseFilter->hotPixelRateMap);
+		noiseFilter->hotPixelRateMap = NULL;
+	}
+
+	if (noiseFilter->hotPixelSetMap != NULL) {
+		free(noiseFilter->hotPixelSetMap);
+		noiseFilter->hotPixelSetMap = NULL;
+	}
+
+	noiseFilter->hotPixelContinuousStarted = false;
+}
+
+static void hotPixelContinuousAdvance(caerFilterDVSNoise noiseFilter, int64_t timestamp) {
+	size_t pixelNumber = (size_t) noiseFilter->sizeX * (size_t) noiseFilter->sizeY;
+	int64_t decayTime  = (noiseFilter->hotPixelTime == 0) ? (1) : (noiseFilter->hotPixelTime);
+
+	// Number of elapsed epochs, at least one if we got called.
+	int64_t epochs = ((timestamp - noiseFilter->hotPixelContinuousNextTime) / decayTime) + 1;
+	noiseFilter->hotPixelContinuousNextTime += epochs * decayTime;
+
+	if (epochs >= HOTPIXEL_RATE_DECAY_MAX_EPOCHS) {
+		// All estimates decayed to zero, start over.
+		memset(noiseFilter->hotPixelRateMap, 0, pixelNumber * sizeof(uint32_t));
+
+		noiseFilter->hotPixelContinuousEpoch              = 0;
+		noiseFilter->hotPixelContinuousEpochsSinceRefresh = 0;
+	}
+	else {
+		noiseFilter->hotPixelContinuousEpoch = U8T(noiseFilter->hotPixelContinuousEpoch + epochs);
+		noiseFilter->hotPixelContinuousEpochsSinceRefresh
+			= U8T(noiseFilter->hotPixelContinuousEpochsSinceRefresh + epochs);
+
+		if (noiseFilter->hotPixelContinuousEpochsSinceRefresh >= HOTPIXEL_RATE_REFRESH_EPOCHS) {
+			uint8_t epoch = noiseFilter->hotPixelContinuousEpoch;
+
+			for (size_t i = 0; i < pixelNumber; i++) {
+				uint32_t rate = noiseFilter->hotPixelRateMap[i];
+				uint8_t decay = U8T(epoch - HOTPIXEL_RATE_EPOCH(rate));
+
+				noiseFilter->hotPixelRateMap[i] = HOTPIXEL_RATE_PACK(
+					epoch, (decay >= HOTPIXEL_RATE_DECAY_MAX_EPOCHS) ? (0) : (HOTPIXEL_RATE_COUNT(rate) >> decay));
+			}
+
+			noiseFilter->hotPixelContinuousEpochsSinceRefresh = 0;
+		}
+	}
+
+	// Remove pixels from the hot set that are not active enough anymore.
+	// Use half the threshold to avoid pixels flickering in and out of the set.
+	uint32_t releaseCount = (noiseFilter->hotPixelCount / 2) + (noiseFilter->hotPixelCount & 0x01);
+	size_t kept           = 0;
+
+	for (size_t i = 0; i < noiseFilter->hotPixelArraySize; i++) {
+		size_t pixelIndex = (noiseFilter->hotPixelArray[i].y * (size_t) noiseFilter->sizeX)
+							+ noiseFilter->hotPixelArray[i].x;
+		uint32_t rate  = noiseFilter->hotPixelRateMap[pixelIndex];
+		uint8_t decay  = U8T(noiseFilter->hotPixelContinuousEpoch - HOTPIXEL_RATE_EPOCH(rate));
+		uint32_t count = (decay >= HOTPIXEL_RATE_DECAY_MAX_EPOCHS) ? (0) : (HOTPIXEL_RATE_COUNT(rate) >> decay);
+
+		if (count < releaseCount) {
+			HOTPIXEL_SET_CLEAR(noiseFilter->hotPixelSetMap, pixelIndex);
+
+			filterDVSNoiseLog(CAER_LOG_DEBUG, noiseFilter,
+				"HotPixel Continuous: removed X=%" PRIu16 ", Y=%" PRIu16 ", count=%" PRIu32 ".",
+				noiseFilter->hotPixelArray[i].x, noiseFilter->hotPixelArray[i].y, count);
+			continue;
+		}
+
+		noiseFilter->hotPixelArray[kept++] = noiseFilter->hotPixelArray[i];
+	}
+
+	noiseFilter->hotPixelArraySize = kept;
+}
+
+static void hotPixelContinuousAdd(caerFilterDVSNoise noiseFilter, size_t pixelIndex) {
+	// Grow array geometrically, the set is usually small and stable.
+	if (noiseFilter->hotPixelArraySize == noiseFilter->hotPixelArrayCapacity) {
+		size_t newCapacity
+			= (noiseFilter->hotPixelArrayCapacity == 0) ? (16) : (noiseFilter->hotPixelArrayCapacity * 2);
+
+		struct caer_filter_dvs_pixel *newArray
+			= realloc(noiseFilter->hotPixelArray, newCapacity * sizeof(struct caer_filter_dvs_pixel));
+		if (newArray == NULL) {
+			filterDVSNoiseLog(
+				CAER_LOG_ERROR, noiseFilter, "HotPixel Continuous: failed to allocate memory for hot pixels array.");
+			return;
+		}
+
+		noiseFilter->hotPixelArray         = newArray;
+		noiseFilter->hotPixelArrayCapacity = newCapacity;
+	}
+
+	struct caer_filter_dvs_pixel *pixel = &noiseFilter->hotPixelArray[noiseFilter->hotPixelArraySize++];
+	pixel->x                            = U16T(pixelIndex % noiseFilter->sizeX);
+	pixel->y                            = U16T(pixelIndex / noiseFilter->sizeX);
+
+	HOTPIXEL_SET_SET(noiseFilter->hotPixelSetMap, pixelIndex);
+
+	filterDVSNoiseLog(CAER_LOG_DEBUG, noiseFilter, "HotPixel Continuous: added X=%" PRIu16 ", Y=%" PRIu16 ".",
+		pixel->x, pixel->y);
+}
+
+static void hotPixelContinuousSyncSet(caerFilterDVSNoise noiseFilter) {
+	size_t pixelNumber = (size_t) noiseFilter->sizeX * (size_t) noiseFilter->sizeY;
+
+	memset(noiseFilter->hotPixelSetMap, 0, (pixelNumber + 7) / 8);
+
+	for (size_t i = 0; i < noiseFilter->hotPixelArraySize; i++) {
+		size_t pixelIndex = (noiseFilter->hotPixelArray[i].y * (size_t) noiseFilter->sizeX)
+							+ noiseFilter->hotPixelArray[i].x;
+
+		HOTPIXEL_SET_SET(noiseFilter->hotPixelSetMap, pixelIndex);
+	}
+}
@@ -0,0 +1,17 @@
+#ifndef LIBCAER_SRC_FILTERS_DVS_NOISE_H_
+#define LIBCAER_SRC_FILTERS_DVS_NOISE_H_
+
+#include "libcaer/filters/dvs_noise.h"
+
+// Per-packet and per-event entry points into the DVS noise filter,
+// used to run it fused with other stages in a filter chain.
+// filterDVSNoisePacketStart() must be called once per packet, before
+// passing its events to filterDVSNoiseEvent(). The packet must not be
+// NULL and must contain at least one valid event.
+void filterDVSNoisePacketStart(caerFilterDVSNoise noiseFilter, caerPolarityEventPacketConst polarityPacket);
+
+// Returns true if the event passes the filter, false if it should be invalidated.
+// Statistics and the internal maps are updated in any case.
+bool filterDVSNoiseEvent(caerFilterDVSNoise noiseFilter, uint16_t x, uint16_t y, bool pol, int64_t ts);
+
+#endif /* LIBCAER_SRC_FILTERS_DVS_NOISE_H_ */
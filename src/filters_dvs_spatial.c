@@ -0,0 +1,341 @@
+#include "filters_dvs_spatial.h"
+
+struct caer_filter_dvs_spatial {
+	// Configuration.
+	uint16_t cropStartX;
+	uint16_t cropStartY;
+	uint16_t cropEndX;
+	uint16_t cropEndY;
+	uint16_t subsampleX;
+	uint16_t subsampleY;
+	bool flipX;
+	bool flipY;
+	bool transpose;
+	// Derived values for the branch-free transform, see filterDVSSpatialUpdate().
+	uint32_t spanX;
+	uint32_t spanY;
+	uint32_t notEmpty;
+	uint64_t subsampleMulX;
+	uint64_t subsampleMulY;
+	uint32_t subSizeX;
+	uint32_t subSizeY;
+	uint32_t flipMaskX;
+	uint32_t flipMaskY;
+	uint32_t transposeMask;
+	// Statistics.
+	uint64_t statDropped;
+	// Maximum sizes.
+	uint16_t sizeX;
+	uint16_t sizeY;
+};
+
+static void filterDVSSpatialUpdate(caerFilterDVSSpatial spatialFilter);
+static inline uint32_t filterDVSSpatialTransform(caerFilterDVSSpatial spatialFilter, uint32_t data, uint32_t *keep);
+
+caerFilterDVSSpatial caerFilterDVSSpatialInitialize(uint16_t sizeX, uint16_t sizeY) {
+	if ((sizeX == 0) || (sizeY == 0)) {
+		return (NULL);
+	}
+
+	caerFilterDVSSpatial spatialFilter = calloc(1, sizeof(struct caer_filter_dvs_spatial));
+	if (spatialFilter == NULL) {
+		return (NULL);
+	}
+
+	spatialFilter->sizeX = sizeX;
+	spatialFilter->sizeY = sizeY;
+
+	// Default: full sensor, no transformation.
+	spatialFilter->cropEndX   = U16T(sizeX - 1);
+	spatialFilter->cropEndY   = U16T(sizeY - 1);
+	spatialFilter->subsampleX = 1;
+	spatialFilter->subsampleY = 1;
+
+	filterDVSSpatialUpdate(spatialFilter);
+
+	return (spatialFilter);
+}
+
+void caerFilterDVSSpatialDestroy(caerFilterDVSSpatial spatialFilter) {
+	free(spatialFilter);
+}
+
+// Transform the data word of one event, without any branches, so that the
+// loops calling this can be vectorized by the compiler. Events that are
+// invalid or outside the region keep their data, with the valid mark cleared.
+static inline uint32_t filterDVSSpatialTransform(caerFilterDVSSpatial spatialFilter, uint32_t data, uint32_t *keep) {
+	uint32_t x = (data >> POLARITY_X_ADDR_SHIFT) & POLARITY_X_ADDR_MASK;
+	uint32_t y = (data >> POLARITY_Y_ADDR_SHIFT) & POLARITY_Y_ADDR_MASK;
+
+	// Crop: unsigned wrap-around turns addresses before the start into huge values.
+	uint32_t relX = x - spatialFilter->cropStartX;
+	uint32_t relY = y - spatialFilter->cropStartY;
+
+	uint32_t inside = U32T(relX <= spatialFilter->spanX) & U32T(relY <= spatialFilter->spanY) & spatialFilter->notEmpty;
+	uint32_t valid  = (data & 0x01) & inside;
+
+	// Subsample: divide by multiplying with the reciprocal, see filterDVSSpatialUpdate().
+	uint32_t subX = U32T((relX * spatialFilter->subsampleMulX) >> 32);
+	uint32_t subY = U32T((relY * spatialFilter->subsampleMulY) >> 32);
+
+	// Flip: (v ^ ~0) + size == size - 1 - v, (v ^ 0) + 0 == v.
+	uint32_t flippedX = (subX ^ spatialFilter->flipMaskX) + (spatialFilter->flipMaskX & spatialFilter->subSizeX);
+	uint32_t flippedY = (subY ^ spatialFilter->flipMaskY) + (spatialFilter->flipMaskY & spatialFilter->subSizeY);
+
+	// Transpose.
+	uint32_t outX = (flippedX & ~spatialFilter->transposeMask) | (flippedY & spatialFilter->transposeMask);
+	uint32_t outY = (flippedY & ~spatialFilter->transposeMask) | (flippedX & spatialFilter->transposeMask);
+
+	uint32_t newData = ((outX & POLARITY_X_ADDR_MASK) << POLARITY_X_ADDR_SHIFT)
+					   | ((outY & POLARITY_Y_ADDR_MASK) << POLARITY_Y_ADDR_SHIFT)
+					   | (data & (POLARITY_MASK << POLARITY_SHIFT)) | valid;
+
+	uint32_t validMask = 0U - valid;
+
+	*keep = valid;
+
+	return ((newData & validMask) | (data & ~U32T(0x01) & ~validMask));
+}
+
+void caerFilterDVSSpatialApply(caerFilterDVSSpatial spatialFilter, caerPolarityEventPacket polarity) {
+	// Nothing to process.
+	if ((polarity == NULL) || (caerEventPacketHeaderGetEventValid(&polarity->packetHeader) == 0)) {
+		return;
+	}
+
+	int32_t eventNumber = caerEventPacketHeaderGetEventNumber(&polarity->packetHeader);
+	int32_t eventValid  = caerEventPacketHeaderGetEventValid(&polarity->packetHeader);
+	uint32_t kept       = 0;
+
+	// Go over all events, valid or not, to keep the loop free of branches.
+	for (int32_t i = 0; i < eventNumber; i++) {
+		uint32_t keep;
+		uint32_t data = filterDVSSpatialTransform(spatialFilter, le32toh(polarity->events[i].data), &keep);
+
+		polarity->events[i].data = htole32(data);
+		kept += keep;
+	}
+
+	caerEventPacketHeaderSetEventValid(&polarity->packetHeader, I32T(kept));
+
+	spatialFilter->statDropped += U64T(eventValid) - kept;
+}
+
+caerPolarityEventPacket caerFilterDVSSpatialApplyCopy(
+	caerFilterDVSSpatial spatialFilter, caerPolarityEventPacketConst polarity) {
+	// Nothing to process.
+	if ((polarity == NULL) || (caerEventPacketHeaderGetEventValid(&polarity->packetHeader) == 0)) {
+		return (NULL);
+	}
+
+	int32_t eventNumber = caerEventPacketHeaderGetEventNumber(&polarity->packetHeader);
+	int32_t eventValid  = caerEventPacketHeaderGetEventValid(&polarity->packetHeader);
+
+	// One extra event of space: the output position is always written
+	// to, and only advanced if the event is kept.
+	caerPolarityEventPacket output = caerPolarityEventPacketAllocate(eventValid + 1,
+		caerEventPacketHeaderGetEventSource(&polarity->packetHeader),
+		caerEventPacketHeaderGetEventTSOverflow(&polarity->packetHeader));
+	if (output == NULL) {
+		return (NULL);
+	}
+
+	uint32_t kept = 0;
+
+	for (int32_t i = 0; i < eventNumber; i++) {
+		uint32_t keep;
+		uint32_t data = filterDVSSpatialTransform(spatialFilter, le32toh(polarity->events[i].data), &keep);
+
+		output->events[kept].data      = htole32(data);
+		output->events[kept].timestamp = polarity->events[i].timestamp;
+		kept += keep;
+	}
+
+	spatialFilter->statDropped += U64T(eventValid) - kept;
+
+	if (kept == 0) {
+		free(output);
+		return (NULL);
+	}
+
+	caerEventPacketHeaderSetEventCapacity(&output->packetHeader, I32T(kept));
+	caerEventPacketHeaderSetEventNumber(&output->packetHeader, I32T(kept));
+	caerEventPacketHeaderSetEventValid(&output->packetHeader, I32T(kept));
+
+	return (output);
+}
+
+bool filterDVSSpatialEvent(caerFilterDVSSpatial spatialFilter, caerPolarityEvent event) {
+	uint32_t keep;
+	uint32_t data = filterDVSSpatialTransform(spatialFilter, le32toh(event->data), &keep);
+
+	if (!keep) {
+		spatialFilter->statDropped++;
+		return (false);
+	}
+
+	event->data = htole32(data);
+
+	return (true);
+}
+
+bool caerFilterDVSSpatialConfigSet(caerFilterDVSSpatial spatialFilter, uint8_t paramAddr, uint64_t param) {
+	switch (paramAddr) {
+		case CAER_FILTER_DVS_SPATIAL_CROP_START_X:
+			if (param >= spatialFilter->sizeX) {
+				return (false);
+			}
+
+			spatialFilter->cropStartX = U16T(param);
+			break;
+
+		case CAER_FILTER_DVS_SPATIAL_CROP_START_Y:
+			if (param >= spatialFilter->sizeY) {
+				return (false);
+			}
+
+			spatialFilter->cropStartY = U16T(param);
+			break;
+
+		case CAER_FILTER_DVS_SPATIAL_CROP_END_X:
+			if (param >= spatialFilter->sizeX) {
+				return (false);
+			}
+
+			spatialFilter->cropEndX = U16T(param);
+			break;
+
+		case CAER_FILTER_DVS_SPATIAL_CROP_END_Y:
+			if (param >= spatialFilter->sizeY) {
+				return (false);
+			}
+
+			spatialFilter->cropEndY = U16T(param);
+			break;
+
+		case CAER_FILTER_DVS_SPATIAL_SUBSAMPLE_X:
+			if ((param == 0) || (param > POLARITY_X_ADDR_MASK)) {
+				return (false);
+			}
+
+			spatialFilter->subsampleX = U16T(param);
+			break;
+
+		case CAER_FILTER_DVS_SPATIAL_SUBSAMPLE_Y:
+			if ((param == 0) || (param > POLARITY_Y_ADDR_MASK)) {
+				return (false);
+			}
+
+			spatialFilter->subsampleY = U16T(param);
+			break;
+
+		case CAER_FILTER_DVS_SPATIAL_FLIP_X:
+			spatialFilter->flipX = param;
+			break;
+
+		case CAER_FILTER_DVS_SPATIAL_FLIP_Y:
+			spatialFilter->flipY = param;
+			break;
+
+		case CAER_FILTER_DVS_SPATIAL_TRANSPOSE:
+			spatialFilter->transpose = param;
+			break;
+
+		case CAER_FILTER_DVS_SPATIAL_STATISTICS:
+			// Write anything to reset.
+			spatialFilter->statDropped = 0;
+			break;
+
+		default:
+			// Unrecognized or invalid parameter address.
+			return (false);
+	}
+
+	filterDVSSpatialUpdate(spatialFilter);
+
+	// Done!
+	return (true);
+}
+
+bool caerFilterDVSSpatialConfigGet(caerFilterDVSSpatial spatialFilter, uint8_t paramAddr, uint64_t *param) {
+	// Ensure param is zeroed out.
+	*param = 0;
+
+	switch (paramAddr) {
+		case CAER_FILTER_DVS_SPATIAL_CROP_START_X:
+			*param = spatialFilter->cropStartX;
+			break;
+
+		case CAER_FILTER_DVS_SPATIAL_CROP_START_Y:
+			*param = spatialFilter->cropStartY;
+			break;
+
+		case CAER_FILTER_DVS_SPATIAL_CROP_END_X:
+			*param = spatialFilter->cropEndX;
+			break;
+
+		case CAER_FILTER_DVS_SPATIAL_CROP_END_Y:
+			*param = spatialFilter->cropEndY;
+			break;
+
+		case CAER_FILTER_DVS_SPATIAL_SUBSAMPLE_X:
+			*param = spatialFilter->subsampleX;
+			break;
+
+		case CAER_FILTER_DVS_SPATIAL_SUBSAMPLE_Y:
+			*param = spatialFilter->subsampleY;
+			break;
+
+		case CAER_FILTER_DVS_SPATIAL_FLIP_X:
+			*param = spatialFilter->flipX;
+			break;
+
+		case CAER_FILTER_DVS_SPATIAL_FLIP_Y:
+			*param = spatialFilter->flipY;
+			break;
+
+		case CAER_FILTER_DVS_SPATIAL_TRANSPOSE:
+			*param = spatialFilter->transpose;
+			break;
+
+		case CAER_FILTER_DVS_SPATIAL_OUTPUT_SIZE_X:
+			*param = (spatialFilter->transpose) ? (spatialFilter->subSizeY) : (spatialFilter->subSizeX);
+			break;
+
+		case CAER_FILTER_DVS_SPATIAL_OUTPUT_SIZE_Y:
+			*param = (spatialFilter->transpose) ? (spatialFilter->subSizeX) : (spatialFilter->subSizeY);
+			break;
+
+		case CAER_FILTER_DVS_SPATIAL_STATISTICS:
+			*param = spatialFilter->statDropped;
+			break;
+
+		default:
+			// Unrecognized or invalid parameter address.
+			return (false);
+	}
+
+	// Done!
+	return (true);
+}
+
+static void filterDVSSpatialUpdate(caerFilterDVSSpatial spatialFilter) {
+	bool empty = (spatialFilter->cropStartX > spatialFilter->cropEndX)
+				 || (spatialFilter->cropStartY > spatialFilter->cropEndY);
+
+	spatialFilter->notEmpty = (empty) ? (0) : (1);
+	spatialFilter->spanX    = (empty) ? (0) : U32T(spatialFilter->cropEndX - spatialFilter->cropStartX);
+	spatialFilter->spanY    = (empty) ? (0) : U32T(spatialFilter->cropEndY - spatialFilter->cropStartY);
+
+	// (v * (2^32 / d + 1)) >> 32 == v / d, exact as long as v * d < 2^32,
+	// which holds for addresses and factors, both at most 15 bits.
+	spatialFilter->subsampleMulX = (UINT64_C(1) << 32) / spatialFilter->subsampleX + 1;
+	spatialFilter->subsampleMulY = (UINT64_C(1) << 32) / spatialFilter->subsampleY + 1;
+
+	spatialFilter->subSizeX = (empty) ? (0) : ((spatialFilter->spanX / spatialFilter->subsampleX) + 1);
+	spatialFilter->subSizeY = (empty) ? (0) : ((spatialFilter->spanY / spatialFilter->subsampleY) + 1);
+
+	spatialFilter->flipMaskX     = (spatialFilter->flipX) ? (UINT32_MAX) : (0);
+	spatialFilter->flipMaskY     = (spatialFilter->flipY) ? (UINT32_MAX) : (0);
+	spatialFilter->transposeMask = (spatialFilter->transpose) ? (UINT32_MAX) : (0);
+}
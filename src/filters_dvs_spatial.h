@@ -0,0 +1,11 @@
+#ifndef LIBCAER_SRC_FILTERS_DVS_SPATIAL_H_
+#define LIBCAER_SRC_FILTERS_DVS_SPATIAL_H_
+
+#include "libcaer/filters/dvs_spatial.h"
+
+// Per-event entry point into the DVS spatial filter, used by the filter chain.
+// The event must be valid. Returns true and rewrites the event address if it
+// is kept, returns false and leaves the event untouched if it is dropped.
+bool filterDVSSpatialEvent(caerFilterDVSSpatial spatialFilter, caerPolarityEvent event);
+
+#endif /* LIBCAER_SRC_FILTERS_DVS_SPATIAL_H_ */
@@ -1,5 +1,7 @@
 #include "libcaer/frame_utils.h"
 
+#include "parallel_jobs.h"
+
 #if defined(LIBCAER_HAVE_OPENCV) && LIBCAER_HAVE_OPENCV == 1
 // Use C++ OpenCV demosaic and contrast functions, defined
 // separately in 'frame_utils_opencv.cpp'.
@@ -27,12 +29,626 @@ enum caer_frame_utils_pixel_color caerFrameUtilsPixelColor(
 	return (colorKeys[colorFilter][((x & 0x01) << 1) | (y & 0x01)]);
 }
 
+// Demosaic: where each color component of a pixel comes from, based only on
+// the color of the pixel itself, as the Bayer pattern fixes its neighbors.
+enum demosaic_source {
+	SRC_CENTER,     // The pixel itself.
+	SRC_HORIZONTAL, // Average of left and right neighbors.
+	SRC_VERTICAL,   // Average of up and down neighbors.
+	SRC_CROSS,      // Average of left, right, up and down neighbors.
+	SRC_DIAGONAL,   // Average of the four diagonal neighbors.
+};
+
+// R, G, B component sources, indexed by pixel color.
+static const enum demosaic_source demosaicSources[5][3] = {
+	[PX_COLOR_R]  = {SRC_CENTER, SRC_CROSS, SRC_DIAGONAL},
+	[PX_COLOR_B]  = {SRC_DIAGONAL, SRC_CROSS, SRC_CENTER},
+	[PX_COLOR_G1] = {SRC_HORIZONTAL, SRC_CENTER, SRC_VERTICAL},
+	[PX_COLOR_G2] = {SRC_VERTICAL, SRC_CENTER, SRC_HORIZONTAL},
+	// W pixel, modified Bayer pattern instead of G2.
+	// TODO: how can W itself contribute to the three colors?
+	[PX_COLOR_W] = {SRC_VERTICAL, SRC_DIAGONAL, SRC_HORIZONTAL},
+};
+
+// Demosaic output: either 16bit pixels, or 8bit pixels mapped through a
+// lookup table (indexed by value - lutOffset), see contrastLUT8Bit().
+struct demosaic_output {
+	uint16_t *pixels;
+	uint8_t *pixels8Bit;
+	const uint8_t *lut;
+	uint16_t lutOffset;
+	enum caer_frame_event_color_channels channels;
+};
+
+static inline void demosaicStore(const struct demosaic_output *output, size_t idx, uint32_t RComp, uint32_t GComp,
+	uint32_t BComp, enum caer_frame_event_color_channels channels, bool use8Bit) {
+	if (channels == GRAYSCALE) {
+		uint32_t grayComp = (RComp + GComp + BComp) / 3;
+
+		if (use8Bit) {
+			output->pixels8Bit[idx] = output->lut[grayComp - output->lutOffset];
+		}
+		else {
+			output->pixels[idx] = U16T(grayComp);
+		}
+	}
+	else {
+		if (use8Bit) {
+			output->pixels8Bit[(idx * RGB)]     = output->lut[RComp - output->lutOffset];
+			output->pixels8Bit[(idx * RGB) + 1] = output->lut[GComp - output->lutOffset];
+			output->pixels8Bit[(idx * RGB) + 2] = output->lut[BComp - output->lutOffset];
+		}
+		else {
+			output->pixels[(idx * RGB)]     = U16T(RComp);
+			output->pixels[(idx * RGB) + 1] = U16T(GComp);
+			output->pixels[(idx * RGB) + 2] = U16T(BComp);
+		}
+	}
+}
+
+// Border pixels: average only over the neighbors that are inside the frame.
+// Frames only one pixel wide or high can have none of the needed color,
+// use the center pixel then.
+static uint32_t demosaicBorderComponent(
+	const uint16_t *inPixels, int32_t lengthX, int32_t lengthY, int32_t x, int32_t y, enum demosaic_source source) {
+	static const int8_t offsets[5][4][2] = {
+		[SRC_CENTER]     = {{0, 0}},
+		[SRC_HORIZONTAL] = {{-1, 0}, {1, 0}},
+		[SRC_VERTICAL]   = {{0, -1}, {0, 1}},
+		[SRC_CROSS]      = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}},
+		[SRC_DIAGONAL]   = {{-1, -1}, {1, -1}, {-1, 1}, {1, 1}},
+	};
+	static const uint8_t offsetsNumber[5] = {
+		[SRC_CENTER] = 1, [SRC_HORIZONTAL] = 2, [SRC_VERTICAL] = 2, [SRC_CROSS] = 4, [SRC_DIAGONAL] = 4};
+
+	uint32_t sum   = 0;
+	uint32_t count = 0;
+
+	for (size_t i = 0; i < offsetsNumber[source]; i++) {
+		int32_t nx = x + offsets[source][i][0];
+		int32_t ny = y + offsets[source][i][1];
+
+		if ((nx >= 0) && (nx < lengthX) && (ny >= 0) && (ny < lengthY)) {
+			sum += inPixels[(ny * lengthX) + nx];
+			count++;
+		}
+	}
+
+	return ((count == 0) ? (inPixels[(y * lengthX) + x]) : (sum / count));
+}
+
+static void demosaicBorderPixel(const uint16_t *inPixels, const struct demosaic_output *output, int32_t lengthX,
+	int32_t lengthY, int32_t x, int32_t y, enum caer_frame_utils_pixel_color pixelColor) {
+	const enum demosaic_source *sources = demosaicSources[pixelColor];
+
+	demosaicStore(output, (size_t) ((y * lengthX) + x),
+		demosaicBorderComponent(inPixels, lengthX, lengthY, x, y, sources[0]),
+		demosaicBorderComponent(inPixels, lengthX, lengthY, x, y, sources[1]),
+		demosaicBorderComponent(inPixels, lengthX, lengthY, x, y, sources[2]), output->channels,
+		(output->pixels8Bit != NULL));
+}
+
+// In-between pixels: all neighbors exist, the source is a fixed expression.
+static inline uint32_t demosaicInteriorComponent(
+	const uint16_t *center, int32_t lengthX, enum demosaic_source source) {
+	switch (source) {
+		case SRC_CENTER:
+			return (center[0]);
+
+		case SRC_HORIZONTAL:
+			return ((U32T(center[-1]) + center[1]) / 2);
+
+		case SRC_VERTICAL:
+			return ((U32T(center[-lengthX]) + center[lengthX]) / 2);
+
+		case SRC_CROSS:
+			return ((U32T(center[-1]) + center[1] + center[-lengthX] + center[lengthX]) / 4);
+
+		case SRC_DIAGONAL:
+			return ((U32T(center[-lengthX - 1]) + center[-lengthX + 1] + center[lengthX - 1] + center[lengthX + 1])
+					/ 4);
+	}
+
+	return (0);
+}
+
+// One Bayer phase of an in-between row: every second pixel, starting at
+// xStart, excluding the first and last columns. Called with constant sources
+// and output format, so that each gets its own branch-free loop after inlining.
+static inline void demosaicInteriorPhase(const uint16_t *inRow, const struct demosaic_output *output,
+	size_t outRowIdx, int32_t lengthX, int32_t xStart, enum demosaic_source RSource, enum demosaic_source GSource,
+	enum demosaic_source BSource, enum caer_frame_event_color_channels channels, bool use8Bit) {
+	for (int32_t x = xStart; x < (lengthX - 1); x += 2) {
+		const uint16_t *center = inRow + x;
+
+		demosaicStore(output, outRowIdx + (size_t) x, demosaicInteriorComponent(center, lengthX, RSource),
+			demosaicInteriorComponent(center, lengthX, GSource), demosaicInteriorComponent(center, lengthX, BSource),
+			channels, use8Bit);
+	}
+}
+
+static void demosaicInteriorRow(const uint16_t *inPixels, const struct demosaic_output *output, int32_t lengthX,
+	int32_t y, int32_t xStart, enum caer_frame_utils_pixel_color pixelColor) {
+	const uint16_t *inRow = inPixels + (y * lengthX);
+	size_t outRowIdx      = (size_t) (y * lengthX);
+
+	// Expand sources and output format as constants, one specialized loop each.
+#define DEMOSAIC_PHASE(R, G, B)                                                                          \
+	if (output->pixels8Bit != NULL) {                                                                    \
+		if (output->channels == GRAYSCALE) {                                                             \
+			demosaicInteriorPhase(inRow, output, outRowIdx, lengthX, xStart, R, G, B, GRAYSCALE, true);  \
+		}                                                                                                \
+		else {                                                                                           \
+			demosaicInteriorPhase(inRow, output, outRowIdx, lengthX, xStart, R, G, B, RGB, true);        \
+		}                                                                                                \
+	}                                                                                                    \
+	else {                                                                                               \
+		if (output->channels == GRAYSCALE) {                                                             \
+			demosaicInteriorPhase(inRow, output, outRowIdx, lengthX, xStart, R, G, B, GRAYSCALE, false); \
+		}                                                                                                \
+		else {                                                                                           \
+			demosaicInteriorPhase(inRow, output, outRowIdx, lengthX, xStart, R, G, B, RGB, false);       \
+		}                                                                                                \
+	}
+
+	switch (pixelColor) {
+		case PX_COLOR_R:
+			DEMOSAIC_PHASE(SRC_CENTER, SRC_CROSS, SRC_DIAGONAL);
+			break;
+
+		case PX_COLOR_B:
+			DEMOSAIC_PHASE(SRC_DIAGONAL, SRC_CROSS, SRC_CENTER);
+			break;
+
+		case PX_COLOR_G1:
+			DEMOSAIC_PHASE(SRC_HORIZONTAL, SRC_CENTER, SRC_VERTICAL);
+			break;
+
+		case PX_COLOR_G2:
+			DEMOSAIC_PHASE(SRC_VERTICAL, SRC_CENTER, SRC_HORIZONTAL);
+			break;
+
+		case PX_COLOR_W:
+			DEMOSAIC_PHASE(SRC_VERTICAL, SRC_DIAGONAL, SRC_HORIZONTAL);
+			break;
+	}
+
+#undef DEMOSAIC_PHASE
+}
+
+static void demosaicFrame(caerFrameEventConst inputFrame, const struct demosaic_output *output) {
+	const uint16_t *inPixels = caerFrameEventGetPixelArrayUnsafeConst(inputFrame);
+
+	enum caer_frame_event_color_filter colorFilter = caerFrameEventGetColorFilter(inputFrame);
+	int32_t lengthX                                = caerFrameEventGetLengthX(inputFrame);
+	int32_t lengthY                                = caerFrameEventGetLengthY(inputFrame);
+	int32_t positionX                              = caerFrameEventGetPositionX(inputFrame);
+	int32_t positionY                              = caerFrameEventGetPositionY(inputFrame);
+
+	for (int32_t y = 0; y < lengthY; y++) {
+		if ((y == 0) || (y == (lengthY - 1)) || (lengthX < 3)) {
+			// First and last rows: all pixels are border pixels.
+			for (int32_t x = 0; x < lengthX; x++) {
+				demosaicBorderPixel(inPixels, output, lengthX, lengthY, x, y,
+					caerFrameUtilsPixelColor(colorFilter, positionX + x, positionY + y));
+			}
+
+			continue;
+		}
+
+		// In-between rows: first and last columns are border pixels.
+		demosaicBorderPixel(inPixels, output, lengthX, lengthY, 0, y,
+			caerFrameUtilsPixelColor(colorFilter, positionX, positionY + y));
+		demosaicBorderPixel(inPixels, output, lengthX, lengthY, lengthX - 1, y,
+			caerFrameUtilsPixelColor(colorFilter, positionX + lengthX - 1, positionY + y));
+
+		// In-between columns alternate between two Bayer phases.
+		demosaicInteriorRow(
+			inPixels, output, lengthX, y, 1, caerFrameUtilsPixelColor(colorFilter, positionX + 1, positionY + y));
+		demosaicInteriorRow(
+			inPixels, output, lengthX, y, 2, caerFrameUtilsPixelColor(colorFilter, positionX + 2, positionY + y));
+	}
+}
+
+// Contrast: minimum and maximum pixel values, without branches in the loop
+// so that the compiler can turn it into vector min/max instructions.
+static void contrastMinMax(const uint16_t *pixels, size_t pixelsSize, uint16_t *minValue, uint16_t *maxValue) {
+	uint16_t minVal = UINT16_MAX;
+	uint16_t maxVal = 0;
+
+	for (size_t idx = 0; idx < pixelsSize; idx++) {
+		minVal = (pixels[idx] < minVal) ? (pixels[idx]) : (minVal);
+		maxVal = (pixels[idx] > maxVal) ? (pixels[idx]) : (maxVal);
+	}
+
+	*minValue = minVal;
+	*maxValue = maxVal;
+}
+
+// Contrast: O(x, y) = alpha * (I(x, y) - min), where alpha maximizes the
+// range (contrast) and subtracting min shifts it so lowest is zero
+// (brightness). Precomputed for every value between min and max, so
+// applying it is one table lookup per pixel. A uniform frame (min == max)
+// has no range to stretch, its values are kept as they are.
+static uint16_t *contrastLUT(uint16_t minValue, uint16_t maxValue) {
+	uint32_t range = U32T(maxValue - minValue);
+
+	uint16_t *lut = malloc((range + 1) * sizeof(uint16_t));
+	if (lut == NULL) {
+		return (NULL);
+	}
+
+	if (range == 0) {
+		lut[0] = minValue;
+	}
+	else {
+		for (uint32_t i = 0; i <= range; i++) {
+			lut[i] = U16T((i * UINT16_MAX) / range);
+		}
+	}
+
+	return (lut);
+}
+
+// Same as contrastLUT(), but with 8bit output values, for display.
+static uint8_t *contrastLUT8Bit(uint16_t minValue, uint16_t maxValue) {
+	uint32_t range = U32T(maxValue - minValue);
+
+	uint8_t *lut = malloc((range + 1) * sizeof(uint8_t));
+	if (lut == NULL) {
+		return (NULL);
+	}
+
+	if (range == 0) {
+		lut[0] = U8T(minValue >> 8);
+	}
+	else {
+		for (uint32_t i = 0; i <= range; i++) {
+			lut[i] = U8T((i * UINT8_MAX) / range);
+		}
+	}
+
+	return (lut);
+}
+
+// Histogram equalization and CLAHE: work is split into independent jobs
+// (bands of rows, or tiles), run on up to FRAME_UTILS_THREADS threads
+// for frames big enough to make up for the thread start-up cost.
+#define FRAME_UTILS_THREADS             4
+#define FRAME_UTILS_PARALLEL_MIN_PIXELS (128 * 1024)
+#define FRAME_UTILS_PARALLEL_MIN_EVENTS (256 * 1024)
+
+// CLAHE: same defaults as the OpenCV variant (clip limit 4, 8x8 tiles).
+// Tile histograms have 256 bins spread over the range of values actually
+// present in the frame: with the full 16bit range, bins would be so sparse
+// that any clip limit flattens them completely. Interpolation between tiles
+// is done with 10bit weights.
+#define CLAHE_TILES        8
+#define CLAHE_CLIP_LIMIT   4
+#define CLAHE_BINS         256
+#define CLAHE_WEIGHT_SHIFT 10
+#define CLAHE_WEIGHT_ONE   (1 << CLAHE_WEIGHT_SHIFT)
+
+static size_t frameUtilsThreadsNumber(size_t pixelsSize) {
+	return ((pixelsSize >= FRAME_UTILS_PARALLEL_MIN_PIXELS) ? (FRAME_UTILS_THREADS) : (1));
+}
+
+struct contrast_equalize {
+	const uint16_t *inPixels;
+	uint16_t *outPixels;
+	size_t pixelsSize;
+	size_t bandsNumber;
+	uint32_t *histograms; // One full 16bit histogram per band.
+	uint16_t *lut;
+};
+
+static void contrastEqualizeHistogramJob(void *data, size_t band) {
+	struct contrast_equalize *equalize = data;
+
+	uint32_t *histogram = equalize->histograms + (band * (UINT16_MAX + 1));
+	size_t start        = (equalize->pixelsSize * band) / equalize->bandsNumber;
+	size_t end          = (equalize->pixelsSize * (band + 1)) / equalize->bandsNumber;
+
+	for (size_t idx = start; idx < end; idx++) {
+		histogram[equalize->inPixels[idx]]++;
+	}
+}
+
+static void contrastEqualizeApplyJob(void *data, size_t band) {
+	struct contrast_equalize *equalize = data;
+
+	size_t start = (equalize->pixelsSize * band) / equalize->bandsNumber;
+	size_t end   = (equalize->pixelsSize * (band + 1)) / equalize->bandsNumber;
+
+	for (size_t idx = start; idx < end; idx++) {
+		equalize->outPixels[idx] = equalize->lut[equalize->inPixels[idx]];
+	}
+}
+
+// Histogram equalization: map each value to its position in the cumulative
+// distribution, stretched to the full 16bit range. Same as the OpenCV variant.
+// The frame is split into one band of pixels per thread.
+static bool contrastEqualize(const uint16_t *inPixels, uint16_t *outPixels, size_t pixelsSize) {
+	// Nothing to split into bands.
+	if (pixelsSize == 0) {
+		return (true);
+	}
+
+	size_t threadsNumber = frameUtilsThreadsNumber(pixelsSize);
+
+	struct contrast_equalize equalize = {
+		.inPixels    = inPixels,
+		.outPixels   = outPixels,
+		.pixelsSize  = pixelsSize,
+		.bandsNumber = threadsNumber,
+		.histograms  = calloc(threadsNumber * (UINT16_MAX + 1), sizeof(uint32_t)),
+		.lut         = malloc((UINT16_MAX + 1) * sizeof(uint16_t)),
+	};
+
+	if ((equalize.histograms == NULL) || (equalize.lut == NULL)) {
+		free(equalize.histograms);
+		free(equalize.lut);
+		return (false);
+	}
+
+	parallelJobsRun(&contrastEqualizeHistogramJob, &equalize, threadsNumber, threadsNumber);
+
+	// Merge band histograms into a cumulative distribution, and find its
+	// smallest non-zero value.
+	uint32_t *cdf = equalize.histograms;
+	uint64_t sum  = 0;
+	uint64_t min  = 0;
+
+	for (size_t i = 0; i <= UINT16_MAX; i++) {
+		for (size_t band = 1; band < threadsNumber; band++) {
+			cdf[i] += equalize.histograms[(band * (UINT16_MAX + 1)) + i];
+		}
+
+		sum += cdf[i];
+		cdf[i] = U32T(sum);
+
+		if ((min == 0) && (sum > 0)) {
+			min = sum;
+		}
+	}
+
+	for (size_t i = 0; i <= UINT16_MAX; i++) {
+		if (sum == min) {
+			// Uniform frame: nothing to spread out, keep values as they are.
+			equalize.lut[i] = U16T(i);
+		}
+		else if (cdf[i] < min) {
+			// Below the minimum value, never used.
+			equalize.lut[i] = 0;
+		}
+		else {
+			equalize.lut[i] = U16T(((cdf[i] - min) * UINT16_MAX) / (sum - min));
+		}
+	}
+
+	parallelJobsRun(&contrastEqualizeApplyJob, &equalize, threadsNumber, threadsNumber);
+
+	free(equalize.histograms);
+	free(equalize.lut);
+
+	return (true);
+}
+
+struct contrast_clahe {
+	const uint16_t *inPixels;
+	uint16_t *outPixels;
+	int32_t lengthX;
+	int32_t lengthY;
+	int32_t tilesX;
+	int32_t tilesY;
+	size_t bandsNumber;
+	uint16_t minValue;
+	uint64_t binScale; // Maps (value - minValue) to a bin, 16bit fixed-point.
+	uint16_t *luts;    // One lookup table (CLAHE_BINS entries) per tile.
+	// Per-column interpolation: left and right tile, and right tile weight.
+	int32_t *columnTileLeft;
+	int32_t *columnTileRight;
+	uint32_t *columnWeight;
+};
+
+static inline size_t claheBin(const struct contrast_clahe *clahe, uint16_t value) {
+	return ((size_t) ((U64T(value - clahe->minValue) * clahe->binScale) >> 16));
+}
+
+// Interpolation between the two nearest tile centers for a pixel position.
+static void claheInterpolation(int32_t position, int32_t length, int32_t tiles, int32_t *tileLow,
+	int32_t *tileHigh, uint32_t *weightHigh) {
+	float tilePosition = ((((float) position + 0.5f) * (float) tiles) / (float) length) - 0.5f;
+
+	if (tilePosition <= 0) {
+		// Before the first tile center.
+		*tileLow    = 0;
+		*tileHigh   = 0;
+		*weightHigh = 0;
+	}
+	else if (tilePosition >= (float) (tiles - 1)) {
+		// After the last tile center.
+		*tileLow    = tiles - 1;
+		*tileHigh   = tiles - 1;
+		*weightHigh = 0;
+	}
+	else {
+		*tileLow    = (int32_t) tilePosition;
+		*tileHigh   = *tileLow + 1;
+		*weightHigh = U32T((tilePosition - (float) *tileLow) * (float) CLAHE_WEIGHT_ONE);
+	}
+}
+
+// One tile: clipped histogram, redistribution of the excess, then the
+// cumulative distribution as lookup table.
+static void contrastCLAHETileJob(void *data, size_t tile) {
+	struct contrast_clahe *clahe = data;
+
+	int32_t tileX  = I32T(tile % (size_t) clahe->tilesX);
+	int32_t tileY  = I32T(tile / (size_t) clahe->tilesX);
+	int32_t startX = (tileX * clahe->lengthX) / clahe->tilesX;
+	int32_t endX   = ((tileX + 1) * clahe->lengthX) / clahe->tilesX;
+	int32_t startY = (tileY * clahe->lengthY) / clahe->tilesY;
+	int32_t endY   = ((tileY + 1) * clahe->lengthY) / clahe->tilesY;
+
+	uint32_t histogram[CLAHE_BINS] = {0};
+
+	for (int32_t y = startY; y < endY; y++) {
+		const uint16_t *row = clahe->inPixels + (y * clahe->lengthX);
+
+		for (int32_t x = startX; x < endX; x++) {
+			histogram[claheBin(clahe, row[x])]++;
+		}
+	}
+
+	uint32_t tilePixels = U32T((endX - startX) * (endY - startY));
+
+	uint32_t clipLimit = (CLAHE_CLIP_LIMIT * tilePixels) / CLAHE_BINS;
+	if (clipLimit < 1) {
+		clipLimit = 1;
+	}
+
+	uint32_t excess = 0;
+
+	for (size_t i = 0; i < CLAHE_BINS; i++) {
+		if (histogram[i] > clipLimit) {
+			excess += histogram[i] - clipLimit;
+			histogram[i] = clipLimit;
+		}
+	}
+
+	// Redistribute excess evenly, the remainder spread out over the range.
+	uint32_t excessPerBin = excess / CLAHE_BINS;
+	uint32_t excessRest   = excess % CLAHE_BINS;
+
+	for (size_t i = 0; i < CLAHE_BINS; i++) {
+		histogram[i] += excessPerBin;
+	}
+
+	for (size_t i = 0; i < excessRest; i++) {
+		histogram[(i * CLAHE_BINS) / excessRest]++;
+	}
+
+	uint16_t *lut = clahe->luts + (tile * CLAHE_BINS);
+	uint64_t sum  = 0;
+
+	for (size_t i = 0; i < CLAHE_BINS; i++) {
+		sum += histogram[i];
+		lut[i] = U16T((sum * UINT16_MAX) / tilePixels);
+	}
+}
+
+// One band of rows: bilinear interpolation between the lookup tables of
+// the four nearest tiles.
+static void contrastCLAHEApplyJob(void *data, size_t band) {
+	struct contrast_clahe *clahe = data;
+
+	int32_t startY = I32T(((size_t) clahe->lengthY * band) / clahe->bandsNumber);
+	int32_t endY   = I32T(((size_t) clahe->lengthY * (band + 1)) / clahe->bandsNumber);
+
+	for (int32_t y = startY; y < endY; y++) {
+		int32_t tileTop;
+		int32_t tileBottom;
+		uint32_t weightBottom;
+		claheInterpolation(y, clahe->lengthY, clahe->tilesY, &tileTop, &tileBottom, &weightBottom);
+
+		const uint16_t *lutsTop    = clahe->luts + ((size_t) (tileTop * clahe->tilesX) * CLAHE_BINS);
+		const uint16_t *lutsBottom = clahe->luts + ((size_t) (tileBottom * clahe->tilesX) * CLAHE_BINS);
+
+		const uint16_t *inRow = clahe->inPixels + (y * clahe->lengthX);
+		uint16_t *outRow      = clahe->outPixels + (y * clahe->lengthX);
+
+		for (int32_t x = 0; x < clahe->lengthX; x++) {
+			size_t bin   = claheBin(clahe, inRow[x]);
+			size_t left  = ((size_t) clahe->columnTileLeft[x] * CLAHE_BINS) + bin;
+			size_t right = ((size_t) clahe->columnTileRight[x] * CLAHE_BINS) + bin;
+
+			uint32_t weightRight = clahe->columnWeight[x];
+
+			uint32_t top
+				= ((lutsTop[left] * (CLAHE_WEIGHT_ONE - weightRight)) + (lutsTop[right] * weightRight))
+				  >> CLAHE_WEIGHT_SHIFT;
+			uint32_t bottom
+				= ((lutsBottom[left] * (CLAHE_WEIGHT_ONE - weightRight)) + (lutsBottom[right] * weightRight))
+				  >> CLAHE_WEIGHT_SHIFT;
+
+			outRow[x]
+				= U16T(((top * (CLAHE_WEIGHT_ONE - weightBottom)) + (bottom * weightBottom)) >> CLAHE_WEIGHT_SHIFT);
+		}
+	}
+}
+
+// CLAHE (Contrast Limited Adaptive Histogram Equalization): equalize each
+// tile separately, with a clipped histogram to limit noise amplification,
+// and interpolate between tiles to avoid visible tile borders.
+static bool contrastCLAHE(const uint16_t *inPixels, uint16_t *outPixels, int32_t lengthX, int32_t lengthY) {
+	// No tiles and no bands to work on.
+	if ((lengthX <= 0) || (lengthY <= 0)) {
+		return (true);
+	}
+
+	size_t threadsNumber = frameUtilsThreadsNumber((size_t) lengthX * (size_t) lengthY);
+
+	struct contrast_clahe clahe = {
+		.inPixels        = inPixels,
+		.outPixels       = outPixels,
+		.lengthX         = lengthX,
+		.lengthY         = lengthY,
+		.tilesX          = (lengthX < CLAHE_TILES) ? (lengthX) : (CLAHE_TILES),
+		.tilesY          = (lengthY < CLAHE_TILES) ? (lengthY) : (CLAHE_TILES),
+		.bandsNumber     = threadsNumber,
+		.columnTileLeft  = malloc((size_t) lengthX * sizeof(int32_t)),
+		.columnTileRight = malloc((size_t) lengthX * sizeof(int32_t)),
+		.columnWeight    = malloc((size_t) lengthX * sizeof(uint32_t)),
+	};
+
+	uint16_t maxValue;
+	contrastMinMax(inPixels, (size_t) lengthX * (size_t) lengthY, &clahe.minValue, &maxValue);
+
+	clahe.binScale = (U64T(CLAHE_BINS) << 16) / (U64T(maxValue - clahe.minValue) + 1);
+
+	size_t tilesNumber = (size_t) clahe.tilesX * (size_t) clahe.tilesY;
+	clahe.luts         = malloc(tilesNumber * CLAHE_BINS * sizeof(uint16_t));
+
+	if ((clahe.luts == NULL) || (clahe.columnTileLeft == NULL) || (clahe.columnTileRight == NULL)
+		|| (clahe.columnWeight == NULL)) {
+		free(clahe.luts);
+		free(clahe.columnTileLeft);
+		free(clahe.columnTileRight);
+		free(clahe.columnWeight);
+		return (false);
+	}
+
+	for (int32_t x = 0; x < lengthX; x++) {
+		claheInterpolation(
+			x, lengthX, clahe.tilesX, &clahe.columnTileLeft[x], &clahe.columnTileRight[x], &clahe.columnWeight[x]);
+	}
+
+	// All tile tables must be ready before any pixel is written, this
+	// also makes in-place operation possible.
+	parallelJobsRun(&contrastCLAHETileJob, &clahe, tilesNumber, threadsNumber);
+	parallelJobsRun(&contrastCLAHEApplyJob, &clahe, threadsNumber, threadsNumber);
+
+	free(clahe.luts);
+	free(clahe.columnTileLeft);
+	free(clahe.columnTileRight);
+	free(clahe.columnWeight);
+
+	return (true);
+}
+
 void caerFrameUtilsDemosaic(
 	caerFrameEventConst inputFrame, caerFrameEvent outputFrame, enum caer_frame_utils_demosaic_types demosaicType) {
 	if ((inputFrame == NULL) || (outputFrame == NULL)) {
 		return;
 	}
 
+	if ((caerFrameEventGetPixelFormat(inputFrame) != PIXEL_FORMAT_16BIT)
+		|| (caerFrameEventGetPixelFormat(outputFrame) != PIXEL_FORMAT_16BIT)) {
+		caerLog(CAER_LOG_ERROR, __func__, "Demosaic is only possible on frames with 16 bit pixels.");
+		return;
+	}
+
 	if (caerFrameEventGetChannelNumber(inputFrame) != GRAYSCALE) {
 		caerLog(CAER_LOG_ERROR, __func__,
 			"Demosaic is only possible on input frames with only one channel (intensity -> color).");
@@ -88,382 +704,12 @@ void caerFrameUtilsDemosaic(
 	}
 
 	// Then the actual pixels.
-	const uint16_t *inPixels = caerFrameEventGetPixelArrayUnsafeConst(inputFrame);
-	uint16_t *outPixels      = caerFrameEventGetPixelArrayUnsafe(outputFrame);
-
-	enum caer_frame_event_color_filter colorFilter = caerFrameEventGetColorFilter(inputFrame);
-	int32_t lengthX                                = caerFrameEventGetLengthX(inputFrame);
-	int32_t lengthY                                = caerFrameEventGetLengthY(inputFrame);
-	int32_t idxCENTER                              = 0;
-	int32_t idxOUTPUT                              = 0;
-
-	for (int32_t y = 0; y < lengthY; y++) {
-		for (int32_t x = 0; x < lengthX; x++) {
-			// Calculate all neighbor indexes.
-			int32_t idxLEFT  = idxCENTER - 1;
-			int32_t idxRIGHT = idxCENTER + 1;
-
-			int32_t idxCENTERUP = idxCENTER - lengthX;
-			int32_t idxLEFTUP   = idxCENTERUP - 1;
-			int32_t idxRIGHTUP  = idxCENTERUP + 1;
-
-			int32_t idxCENTERDOWN = idxCENTER + lengthX;
-			int32_t idxLEFTDOWN   = idxCENTERDOWN - 1;
-			int32_t idxRIGHTDOWN  = idxCENTERDOWN + 1;
-
-			enum caer_frame_utils_pixel_color pixelColor = caerFrameUtilsPixelColor(
-				colorFilter, caerFrameEventGetPositionX(inputFrame) + x, caerFrameEventGetPositionY(inputFrame) + y);
-
-			int32_t RComp;
-			int32_t GComp;
-			int32_t BComp;
-
-			switch (pixelColor) {
-				case PX_COLOR_R: {
-					// This is a R pixel. It is always surrounded by G and B only.
-					RComp = inPixels[idxCENTER];
-
-					if (y == 0) {
-						// First row.
-						if (x == 0) {
-							// First column.
-							GComp = (inPixels[idxCENTERDOWN] + inPixels[idxRIGHT]) / 2;
-							BComp = inPixels[idxRIGHTDOWN];
-						}
-						else if (x == (lengthX - 1)) {
-							// Last column.
-							GComp = (inPixels[idxCENTERDOWN] + inPixels[idxLEFT]) / 2;
-							BComp = inPixels[idxLEFTDOWN];
-						}
-						else {
-							// In-between columns.
-							GComp = (inPixels[idxCENTERDOWN] + inPixels[idxLEFT] + inPixels[idxRIGHT]) / 3;
-							BComp = (inPixels[idxRIGHTDOWN] + inPixels[idxLEFTDOWN]) / 2;
-						}
-					}
-					else if (y == (lengthY - 1)) {
-						// Last row.
-						if (x == 0) {
-							// First column.
-							GComp = (inPixels[idxCENTERUP] + inPixels[idxRIGHT]) / 2;
-							BComp = inPixels[idxRIGHTUP];
-						}
-						else if (x == (lengthX - 1)) {
-							// Last column.
-							GComp = (inPixels[idxCENTERUP] + inPixels[idxLEFT]) / 2;
-							BComp = inPixels[idxLEFTUP];
-						}
-						else {
-							// In-between columns.
-							GComp = (inPixels[idxCENTERUP] + inPixels[idxLEFT] + inPixels[idxRIGHT]) / 3;
-							BComp = (inPixels[idxRIGHTUP] + inPixels[idxLEFTUP]) / 2;
-						}
-					}
-					else {
-						// In-between rows.
-						if (x == 0) {
-							// First column.
-							GComp = (inPixels[idxCENTERUP] + inPixels[idxCENTERDOWN] + inPixels[idxRIGHT]) / 3;
-							BComp = (inPixels[idxRIGHTUP] + inPixels[idxRIGHTDOWN]) / 2;
-						}
-						else if (x == (lengthX - 1)) {
-							// Last column.
-							GComp = (inPixels[idxCENTERUP] + inPixels[idxCENTERDOWN] + inPixels[idxLEFT]) / 3;
-							BComp = (inPixels[idxLEFTUP] + inPixels[idxLEFTDOWN]) / 2;
-						}
-						else {
-							// In-between columns.
-							GComp = (inPixels[idxCENTERUP] + inPixels[idxCENTERDOWN] + inPixels[idxLEFT]
-										+ inPixels[idxRIGHT])
-									/ 4;
-							BComp = (inPixels[idxRIGHTUP] + inPixels[idxLEFTUP] + inPixels[idxRIGHTDOWN]
-										+ inPixels[idxLEFTDOWN])
-									/ 4;
-						}
-					}
-
-					break;
-				}
-
-				case PX_COLOR_B: {
-					// This is a B pixel. It is always surrounded by G and R only.
-					BComp = inPixels[idxCENTER];
-
-					if (y == 0) {
-						// First row.
-						if (x == 0) {
-							// First column.
-							RComp = inPixels[idxRIGHTDOWN];
-							GComp = (inPixels[idxCENTERDOWN] + inPixels[idxRIGHT]) / 2;
-						}
-						else if (x == (lengthX - 1)) {
-							// Last column.
-							RComp = inPixels[idxLEFTDOWN];
-							GComp = (inPixels[idxCENTERDOWN] + inPixels[idxLEFT]) / 2;
-						}
-						else {
-							// In-between columns.
-							RComp = (inPixels[idxRIGHTDOWN] + inPixels[idxLEFTDOWN]) / 2;
-							GComp = (inPixels[idxCENTERDOWN] + inPixels[idxLEFT] + inPixels[idxRIGHT]) / 3;
-						}
-					}
-					else if (y == (lengthY - 1)) {
-						// Last row.
-						if (x == 0) {
-							// First column.
-							RComp = inPixels[idxRIGHTUP];
-							GComp = (inPixels[idxCENTERUP] + inPixels[idxRIGHT]) / 2;
-						}
-						else if (x == (lengthX - 1)) {
-							// Last column.
-							RComp = inPixels[idxLEFTUP];
-							GComp = (inPixels[idxCENTERUP] + inPixels[idxLEFT]) / 2;
-						}
-						else {
-							// In-between columns.
-							RComp = (inPixels[idxRIGHTUP] + inPixels[idxLEFTUP]) / 2;
-							GComp = (inPixels[idxCENTERUP] + inPixels[idxLEFT] + inPixels[idxRIGHT]) / 3;
-						}
-					}
-					else {
-						// In-between rows.
-						if (x == 0) {
-							// First column.
-							RComp = (inPixels[idxRIGHTUP] + inPixels[idxRIGHTDOWN]) / 2;
-							GComp = (inPixels[idxCENTERUP] + inPixels[idxCENTERDOWN] + inPixels[idxRIGHT]) / 3;
-						}
-						else if (x == (lengthX - 1)) {
-							// Last column.
-							RComp = (inPixels[idxLEFTUP] + inPixels[idxLEFTDOWN]) / 2;
-							GComp = (inPixels[idxCENTERUP] + inPixels[idxCENTERDOWN] + inPixels[idxLEFT]) / 3;
-						}
-						else {
-							// In-between columns.
-							RComp = (inPixels[idxRIGHTUP] + inPixels[idxLEFTUP] + inPixels[idxRIGHTDOWN]
-										+ inPixels[idxLEFTDOWN])
-									/ 4;
-							GComp = (inPixels[idxCENTERUP] + inPixels[idxCENTERDOWN] + inPixels[idxLEFT]
-										+ inPixels[idxRIGHT])
-									/ 4;
-						}
-					}
-
-					break;
-				}
-
-				case PX_COLOR_G1: {
-					// This is a G1 (first green) pixel. It is always surrounded by all of R, G, B.
-					GComp = inPixels[idxCENTER];
-
-					if (y == 0) {
-						// First row.
-						BComp = inPixels[idxCENTERDOWN];
-
-						if (x == 0) {
-							// First column.
-							RComp = inPixels[idxRIGHT];
-						}
-						else if (x == (lengthX - 1)) {
-							// Last column.
-							RComp = inPixels[idxLEFT];
-						}
-						else {
-							// In-between columns.
-							RComp = (inPixels[idxLEFT] + inPixels[idxRIGHT]) / 2;
-						}
-					}
-					else if (y == (lengthY - 1)) {
-						// Last row.
-						BComp = inPixels[idxCENTERUP];
-
-						if (x == 0) {
-							// First column.
-							RComp = inPixels[idxRIGHT];
-						}
-						else if (x == (lengthX - 1)) {
-							// Last column.
-							RComp = inPixels[idxLEFT];
-						}
-						else {
-							// In-between columns.
-							RComp = (inPixels[idxLEFT] + inPixels[idxRIGHT]) / 2;
-						}
-					}
-					else {
-						// In-between rows.
-						BComp = (inPixels[idxCENTERUP] + inPixels[idxCENTERDOWN]) / 2;
-
-						if (x == 0) {
-							// First column.
-							RComp = inPixels[idxRIGHT];
-						}
-						else if (x == (lengthX - 1)) {
-							// Last column.
-							RComp = inPixels[idxLEFT];
-						}
-						else {
-							// In-between columns.
-							RComp = (inPixels[idxLEFT] + inPixels[idxRIGHT]) / 2;
-						}
-					}
-
-					break;
-				}
-
-				case PX_COLOR_G2: {
-					// This is a G2 (second green) pixel. It is always surrounded by all of R, G, B.
-					GComp = inPixels[idxCENTER];
-
-					if (y == 0) {
-						// First row.
-						RComp = inPixels[idxCENTERDOWN];
-
-						if (x == 0) {
-							// First column.
-							BComp = inPixels[idxRIGHT];
-						}
-						else if (x == (lengthX - 1)) {
-							// Last column.
-							BComp = inPixels[idxLEFT];
-						}
-						else {
-							// In-between columns.
-							BComp = (inPixels[idxLEFT] + inPixels[idxRIGHT]) / 2;
-						}
-					}
-					else if (y == (lengthY - 1)) {
-						// Last row.
-						RComp = inPixels[idxCENTERUP];
-
-						if (x == 0) {
-							// First column.
-							BComp = inPixels[idxRIGHT];
-						}
-						else if (x == (lengthX - 1)) {
-							// Last column.
-							BComp = inPixels[idxLEFT];
-						}
-						else {
-							// In-between columns.
-							BComp = (inPixels[idxLEFT] + inPixels[idxRIGHT]) / 2;
-						}
-					}
-					else {
-						// In-between rows.
-						RComp = (inPixels[idxCENTERUP] + inPixels[idxCENTERDOWN]) / 2;
-
-						if (x == 0) {
-							// First column.
-							BComp = inPixels[idxRIGHT];
-						}
-						else if (x == (lengthX - 1)) {
-							// Last column.
-							BComp = inPixels[idxLEFT];
-						}
-						else {
-							// In-between columns.
-							BComp = (inPixels[idxLEFT] + inPixels[idxRIGHT]) / 2;
-						}
-					}
-
-					break;
-				}
-
-				case PX_COLOR_W: {
-					// This is a W pixel, modified Bayer pattern instead of G2.
-					// It is always surrounded by all of R, G, B.
-					// TODO: how can W itself contribute to the three colors?
-					if (y == 0) {
-						// First row.
-						RComp = inPixels[idxCENTERDOWN];
-
-						if (x == 0) {
-							// First column.
-							GComp = inPixels[idxRIGHTDOWN];
-							BComp = inPixels[idxRIGHT];
-						}
-						else if (x == (lengthX - 1)) {
-							// Last column.
-							GComp = inPixels[idxLEFTDOWN];
-							BComp = inPixels[idxLEFT];
-						}
-						else {
-							// In-between columns.
-							GComp = (inPixels[idxRIGHTDOWN] + inPixels[idxLEFTDOWN]) / 2;
-							BComp = (inPixels[idxLEFT] + inPixels[idxRIGHT]) / 2;
-						}
-					}
-					else if (y == (lengthY - 1)) {
-						// Last row.
-						RComp = inPixels[idxCENTERUP];
-
-						if (x == 0) {
-							// First column.
-							GComp = inPixels[idxRIGHTUP];
-							BComp = inPixels[idxRIGHT];
-						}
-						else if (x == (lengthX - 1)) {
-							// Last column.
-							GComp = inPixels[idxLEFTUP];
-							BComp = inPixels[idxRIGHT];
-						}
-						else {
-							// In-between columns.
-							GComp = (inPixels[idxRIGHTUP] + inPixels[idxLEFTUP]) / 2;
-							BComp = (inPixels[idxLEFT] + inPixels[idxRIGHT]) / 2;
-						}
-					}
-					else {
-						// In-between rows.
-						RComp = (inPixels[idxCENTERUP] + inPixels[idxCENTERDOWN]) / 2;
-
-						if (x == 0) {
-							// First column.
-							GComp = (inPixels[idxRIGHTUP] + inPixels[idxRIGHTDOWN]) / 2;
-							BComp = inPixels[idxRIGHT];
-						}
-						else if (x == (lengthX - 1)) {
-							// Last column.
-							GComp = (inPixels[idxLEFTUP] + inPixels[idxLEFTDOWN]) / 2;
-							BComp = inPixels[idxLEFT];
-						}
-						else {
-							// In-between columns.
-							GComp = (inPixels[idxRIGHTUP] + inPixels[idxLEFTUP] + inPixels[idxRIGHTDOWN]
-										+ inPixels[idxLEFTDOWN])
-									/ 4;
-							BComp = (inPixels[idxLEFT] + inPixels[idxRIGHT]) / 2;
-						}
-					}
-
-					break;
-				}
-
-				default:
-					// Do nothing, all colors are examined above.
-					break;
-			}
+	struct demosaic_output output = {
+		.pixels   = caerFrameEventGetPixelArrayUnsafe(outputFrame),
+		.channels = outputColorChannels,
+	};
 
-			if (outputColorChannels == GRAYSCALE) {
-				// Set output frame pixel value for grayscale channel.
-				outPixels[idxOUTPUT] = U16T((RComp + GComp + BComp) / 3);
-
-				// Go to next pixel.
-				idxCENTER++;
-				idxOUTPUT += GRAYSCALE;
-			}
-			else {
-				// Set output frame pixel values for all color channels.
-				outPixels[idxOUTPUT]     = U16T(RComp);
-				outPixels[idxOUTPUT + 1] = U16T(GComp);
-				outPixels[idxOUTPUT + 2] = U16T(BComp);
-
-				// Go to next pixel.
-				idxCENTER++;
-				idxOUTPUT += RGB;
-			}
-		}
-	}
+	demosaicFrame(inputFrame, &output);
 }
 
 void caerFrameUtilsContrast(
@@ -481,13 +727,21 @@ void caerFrameUtilsContrast(
 		return;
 	}
 
-	if (contrastType != CONTRAST_STANDARD) {
+	if ((caerFrameEventGetPixelFormat(inputFrame) != PIXEL_FORMAT_16BIT)
+		|| (caerFrameEventGetPixelFormat(outputFrame) != PIXEL_FORMAT_16BIT)) {
+		caerLog(CAER_LOG_ERROR, __func__, "Contrast enhancement is only possible on frames with 16 bit pixels.");
+		return;
+	}
+
+	if ((contrastType != CONTRAST_STANDARD) && (contrastType != CONTRAST_HISTOGRAM_EQUALIZATION)
+		&& (contrastType != CONTRAST_CLAHE)) {
 #if defined(LIBCAER_HAVE_OPENCV) && LIBCAER_HAVE_OPENCV == 1
 		caerFrameUtilsOpenCVContrast(inputFrame, outputFrame, contrastType);
 #else
 		caerLog(CAER_LOG_ERROR, __func__,
 			"Selected OpenCV contrast enhancement type, but OpenCV support is "
-			"disabled. Either enable it or change to use 'CONTRAST_STANDARD'.");
+			"disabled. Either enable it or change to use 'CONTRAST_STANDARD', "
+			"'CONTRAST_HISTOGRAM_EQUALIZATION' or 'CONTRAST_CLAHE'.");
 #endif
 
 		return;
@@ -495,13 +749,11 @@ void caerFrameUtilsContrast(
 
 	if (caerFrameEventGetChannelNumber(inputFrame) != GRAYSCALE) {
 		caerLog(CAER_LOG_ERROR, __func__,
-			"Standard contrast enhancement only works with grayscale images. For color "
+			"Built-in contrast enhancement only works with grayscale images. For color "
 			"images support, please use one of the OpenCV contrast enhancement types.");
 		return;
 	}
 
-	// O(x, y) = alpha * I(x, y) + beta, where alpha maximizes the range
-	// (contrast) and beta shifts it so lowest is zero (brightness).
 	// Only works with grayscale images currently. Doing so for color (RGB/RGBA) images would require
 	// conversion into another color space that has an intensity channel separate from the color
 	// channels, such as Lab or YCrCb. The same algorithm would then be applied on the intensity only.
@@ -509,32 +761,330 @@ void caerFrameUtilsContrast(
 	uint16_t *outPixels      = caerFrameEventGetPixelArrayUnsafe(outputFrame);
 
 	size_t pixelsSize = caerFrameEventGetPixelsMaxIndex(inputFrame);
+	if (pixelsSize == 0) {
+		return;
+	}
 
-	// On first pass, determine minimum and maximum values.
-	int32_t minValue = INT32_MAX;
-	int32_t maxValue = INT32_MIN;
+	if (contrastType == CONTRAST_HISTOGRAM_EQUALIZATION) {
+		if (!contrastEqualize(inPixels, outPixels, pixelsSize)) {
+			caerLog(CAER_LOG_ERROR, __func__, "Failed to allocate memory for histogram equalization.");
+		}
 
-	for (size_t idx = 0; idx < pixelsSize; idx++) {
-		if (inPixels[idx] < minValue) {
-			minValue = inPixels[idx];
+		return;
+	}
+
+	if (contrastType == CONTRAST_CLAHE) {
+		if (!contrastCLAHE(
+				inPixels, outPixels, caerFrameEventGetLengthX(inputFrame), caerFrameEventGetLengthY(inputFrame))) {
+			caerLog(CAER_LOG_ERROR, __func__, "Failed to allocate memory for CLAHE.");
 		}
 
-		if (inPixels[idx] > maxValue) {
-			maxValue = inPixels[idx];
+		return;
+	}
+
+	uint16_t minValue;
+	uint16_t maxValue;
+	contrastMinMax(inPixels, pixelsSize, &minValue, &maxValue);
+
+	uint16_t *lut = contrastLUT(minValue, maxValue);
+	if (lut == NULL) {
+		caerLog(CAER_LOG_ERROR, __func__, "Failed to allocate memory for contrast lookup table.");
+		return;
+	}
+
+	// Apply lookup table to pixels array (works in-place too).
+	for (size_t idx = 0; idx < pixelsSize; idx++) {
+		outPixels[idx] = lut[inPixels[idx] - minValue];
+	}
+
+	free(lut);
+}
+
+void caerFrameUtilsDemosaicContrast8Bit(
+	caerFrameEventConst inputFrame, uint8_t *outputPixels, enum caer_frame_utils_demosaic_types demosaicType) {
+	if ((inputFrame == NULL) || (outputPixels == NULL)) {
+		return;
+	}
+
+	if (caerFrameEventGetChannelNumber(inputFrame) != GRAYSCALE) {
+		caerLog(CAER_LOG_ERROR, __func__,
+			"Demosaic and contrast to 8bit is only possible on input frames with only one channel.");
+		return;
+	}
+
+	if (caerFrameEventGetPixelFormat(inputFrame) != PIXEL_FORMAT_16BIT) {
+		caerLog(CAER_LOG_ERROR, __func__,
+			"Demosaic and contrast to 8bit is only possible on input frames with 16 bit pixels.");
+		return;
+	}
+
+	if ((demosaicType != DEMOSAIC_STANDARD) && (demosaicType != DEMOSAIC_TO_GRAY)) {
+		caerLog(CAER_LOG_ERROR, __func__,
+			"Demosaic and contrast to 8bit only supports 'DEMOSAIC_STANDARD' or 'DEMOSAIC_TO_GRAY'.");
+		return;
+	}
+
+	const uint16_t *inPixels = caerFrameEventGetPixelArrayUnsafeConst(inputFrame);
+	size_t pixelsSize        = caerFrameEventGetPixelsMaxIndex(inputFrame);
+	if (pixelsSize == 0) {
+		return;
+	}
+
+	// Demosaiced values are input pixels or averages of them, see
+	// demosaicBorderComponent(), so the lookup table covers them.
+	uint16_t minValue;
+	uint16_t maxValue;
+	contrastMinMax(inPixels, pixelsSize, &minValue, &maxValue);
+
+	uint8_t *lut = contrastLUT8Bit(minValue, maxValue);
+	if (lut == NULL) {
+		caerLog(CAER_LOG_ERROR, __func__, "Failed to allocate memory for contrast lookup table.");
+		return;
+	}
+
+	if (caerFrameEventGetColorFilter(inputFrame) == MONO) {
+		// Nothing to demosaic, only contrast and 8bit conversion.
+		for (size_t idx = 0; idx < pixelsSize; idx++) {
+			outputPixels[idx] = lut[inPixels[idx] - minValue];
 		}
 	}
+	else {
+		struct demosaic_output output = {
+			.pixels8Bit = outputPixels,
+			.lut        = lut,
+			.lutOffset  = minValue,
+			.channels   = (demosaicType == DEMOSAIC_STANDARD) ? (RGB) : (GRAYSCALE),
+		};
+
+		demosaicFrame(inputFrame, &output);
+	}
+
+	free(lut);
+}
+
+void caerFrameUtilsConvertPixelFormat(caerFrameEventConst inputFrame, caerFrameEvent outputFrame) {
+	if ((inputFrame == NULL) || (outputFrame == NULL)) {
+		return;
+	}
+
+	if ((caerFrameEventGetChannelNumber(inputFrame) != caerFrameEventGetChannelNumber(outputFrame))
+		|| (caerFrameEventGetLengthX(inputFrame) != caerFrameEventGetLengthX(outputFrame))
+		|| (caerFrameEventGetLengthY(inputFrame) != caerFrameEventGetLengthY(outputFrame))) {
+		caerLog(CAER_LOG_ERROR, __func__,
+			"Pixel format conversion only possible on compatible frames (same number of "
+			"color channels and equal X/Y lengths).");
+		return;
+	}
+
+	enum caer_frame_event_pixel_format inFormat  = caerFrameEventGetPixelFormat(inputFrame);
+	enum caer_frame_event_pixel_format outFormat = caerFrameEventGetPixelFormat(outputFrame);
 
-	// Use min/max to calculate input range.
-	int32_t range = maxValue - minValue;
+	size_t pixelsSize = caerFrameEventGetPixelsMaxIndex(inputFrame);
 
-	// Calculate alpha (contrast).
-	float alpha = ((float) UINT16_MAX) / ((float) range);
+	if (inFormat == outFormat) {
+		memcpy(caerFrameEventGetPixelBytesUnsafe(outputFrame), caerFrameEventGetPixelBytesUnsafeConst(inputFrame),
+			caerFrameEventGetPixelsSize(inputFrame));
+		return;
+	}
 
-	// Calculate beta (brightness).
-	float beta = ((float) -minValue) * alpha;
+	// Fast paths for the common case of compacting 16 bit pixels.
+	if (inFormat == PIXEL_FORMAT_16BIT) {
+		const uint16_t *inPixels = caerFrameEventGetPixelArrayUnsafeConst(inputFrame);
+		uint8_t *outBytes        = caerFrameEventGetPixelBytesUnsafe(outputFrame);
 
-	// Apply alpha and beta to pixels array.
+		if (outFormat == PIXEL_FORMAT_8BIT) {
+			for (size_t idx = 0; idx < pixelsSize; idx++) {
+				outBytes[idx] = U8T(le16toh(inPixels[idx]) >> 8);
+			}
+
+			return;
+		}
+
+		if (outFormat == PIXEL_FORMAT_10BIT_PACKED) {
+			size_t fullGroups = pixelsSize / 4;
+
+			for (size_t group = 0; group < fullGroups; group++) {
+				const uint16_t *in = inPixels + (group * 4);
+				uint8_t *out       = outBytes + (group * 5);
+
+				uint16_t p0 = le16toh(in[0]);
+				uint16_t p1 = le16toh(in[1]);
+				uint16_t p2 = le16toh(in[2]);
+				uint16_t p3 = le16toh(in[3]);
+
+				out[0] = U8T(p0 >> 8);
+				out[1] = U8T(p1 >> 8);
+				out[2] = U8T(p2 >> 8);
+				out[3] = U8T(p3 >> 8);
+				out[4] = U8T(((p0 >> 6) & 0x03) | (((p1 >> 6) & 0x03) << 2) | (((p2 >> 6) & 0x03) << 4)
+							 | (((p3 >> 6) & 0x03) << 6));
+			}
+
+			// Last partial group, if any: clear its low bits byte before filling it.
+			if ((pixelsSize % 4) != 0) {
+				outBytes[(fullGroups * 5) + 4] = 0;
+
+				for (size_t idx = fullGroups * 4; idx < pixelsSize; idx++) {
+					caerFrameEventSetPixelAtIndexUnsafe(outputFrame, idx, le16toh(inPixels[idx]));
+				}
+			}
+
+			return;
+		}
+	}
+
+	// Generic path, through 16 bit values.
 	for (size_t idx = 0; idx < pixelsSize; idx++) {
-		outPixels[idx] = U16T(alpha * ((float) inPixels[idx]) + beta);
+		caerFrameEventSetPixelAtIndexUnsafe(outputFrame, idx, caerFrameEventGetPixelAtIndexUnsafe(inputFrame, idx));
+	}
+}
+
+struct accumulate_events {
+	const struct caer_polarity_event *events;
+	size_t eventsNumber;
+	size_t chunksNumber;
+	int32_t lengthX;
+	int32_t lengthY;
+	int32_t positionX;
+	int32_t positionY;
+	bool signedPolarity;
+	int32_t *accumulation;
+	int32_t *partials; // One image per chunk after the first.
+	size_t pixelsSize;
+	size_t accumulated[FRAME_UTILS_THREADS];
+};
+
+static void accumulateEventsJob(void *data, size_t chunk) {
+	struct accumulate_events *accumulate = data;
+
+	int32_t *image = (chunk == 0) ? (accumulate->accumulation)
+								  : (accumulate->partials + ((chunk - 1) * accumulate->pixelsSize));
+	size_t start = (accumulate->eventsNumber * chunk) / accumulate->chunksNumber;
+	size_t end   = (accumulate->eventsNumber * (chunk + 1)) / accumulate->chunksNumber;
+
+	const uint32_t lengthX   = U32T(accumulate->lengthX);
+	const uint32_t lengthY   = U32T(accumulate->lengthY);
+	const int32_t positionX  = accumulate->positionX;
+	const int32_t positionY  = accumulate->positionY;
+	const int32_t weightBase = (accumulate->signedPolarity) ? (-1) : (1);
+	const int32_t weightStep = (accumulate->signedPolarity) ? (2) : (0);
+
+	size_t accumulated = 0;
+
+	// No branches in here: events outside of the frame or invalid are
+	// added to the first pixel with zero weight.
+	for (size_t i = start; i < end; i++) {
+		uint32_t eventData = le32toh(accumulate->events[i].data);
+
+		uint32_t x = U32T(I32T((eventData >> POLARITY_X_ADDR_SHIFT) & POLARITY_X_ADDR_MASK) - positionX);
+		uint32_t y = U32T(I32T((eventData >> POLARITY_Y_ADDR_SHIFT) & POLARITY_Y_ADDR_MASK) - positionY);
+
+		uint32_t keep = ((eventData >> VALID_MARK_SHIFT) & VALID_MARK_MASK) & (x < lengthX) & (y < lengthY);
+		int32_t weight = weightBase + (weightStep * I32T((eventData >> POLARITY_SHIFT) & POLARITY_MASK));
+
+		size_t idx = ((size_t) y * lengthX + x) * keep;
+		image[idx] += weight * I32T(keep);
+		accumulated += keep;
+	}
+
+	accumulate->accumulated[chunk] = accumulated;
+}
+
+static void accumulateReduceJob(void *data, size_t band) {
+	struct accumulate_events *accumulate = data;
+
+	size_t start = (accumulate->pixelsSize * band) / accumulate->chunksNumber;
+	size_t end   = (accumulate->pixelsSize * (band + 1)) / accumulate->chunksNumber;
+
+	for (size_t chunk = 1; chunk < accumulate->chunksNumber; chunk++) {
+		const int32_t *partial = accumulate->partials + ((chunk - 1) * accumulate->pixelsSize);
+
+		for (size_t idx = start; idx < end; idx++) {
+			accumulate->accumulation[idx] += partial[idx];
+		}
+	}
+}
+
+// Index of the first event with a timestamp not before the given one.
+static int32_t accumulateFindTimestamp(caerPolarityEventPacketConst polarity, int32_t eventNumber, int64_t timestamp) {
+	int32_t low  = 0;
+	int32_t high = eventNumber;
+
+	while (low < high) {
+		int32_t middle = low + ((high - low) / 2);
+
+		if (caerPolarityEventGetTimestamp64(&polarity->events[middle], polarity) < timestamp) {
+			low = middle + 1;
+		}
+		else {
+			high = middle;
+		}
 	}
+
+	return (low);
+}
+
+size_t caerFrameUtilsAccumulateExposureEvents(caerFrameEventConst frame, caerFrameEventPacketConst framePacket,
+	caerPolarityEventPacketConst polarity, int32_t *accumulation,
+	enum caer_frame_utils_accumulate_types accumulateType) {
+	if ((frame == NULL) || (framePacket == NULL) || (polarity == NULL) || (accumulation == NULL)) {
+		return (0);
+	}
+
+	int32_t eventNumber = caerEventPacketHeaderGetEventNumber(&polarity->packetHeader);
+	size_t pixelsSize   = (size_t) caerFrameEventGetLengthX(frame) * (size_t) caerFrameEventGetLengthY(frame);
+	if ((eventNumber == 0) || (pixelsSize == 0)) {
+		return (0);
+	}
+
+	// Events are ordered by time, so the ones inside the exposure window
+	// are one contiguous run, found by binary search.
+	int32_t first = accumulateFindTimestamp(
+		polarity, eventNumber, caerFrameEventGetTSStartOfExposure64(frame, framePacket));
+	int32_t last
+		= accumulateFindTimestamp(polarity, eventNumber, caerFrameEventGetTSEndOfExposure64(frame, framePacket));
+	if (first >= last) {
+		return (0);
+	}
+
+	struct accumulate_events accumulate = {
+		.events         = &polarity->events[first],
+		.eventsNumber   = (size_t)(last - first),
+		.chunksNumber   = 1,
+		.lengthX        = caerFrameEventGetLengthX(frame),
+		.lengthY        = caerFrameEventGetLengthY(frame),
+		.positionX      = caerFrameEventGetPositionX(frame),
+		.positionY      = caerFrameEventGetPositionY(frame),
+		.signedPolarity = (accumulateType == ACCUMULATE_POLARITY),
+		.accumulation   = accumulation,
+		.partials       = NULL,
+		.pixelsSize     = pixelsSize,
+	};
+
+	// Split many events into chunks, each thread integrates its own into
+	// a separate image, these are then summed up. Falls back to a single
+	// chunk if the images can't be allocated.
+	if (accumulate.eventsNumber >= FRAME_UTILS_PARALLEL_MIN_EVENTS) {
+		accumulate.partials = calloc((FRAME_UTILS_THREADS - 1) * pixelsSize, sizeof(int32_t));
+
+		if (accumulate.partials != NULL) {
+			accumulate.chunksNumber = FRAME_UTILS_THREADS;
+		}
+	}
+
+	parallelJobsRun(&accumulateEventsJob, &accumulate, accumulate.chunksNumber, accumulate.chunksNumber);
+
+	size_t accumulated = 0;
+
+	for (size_t chunk = 0; chunk < accumulate.chunksNumber; chunk++) {
+		accumulated += accumulate.accumulated[chunk];
+	}
+
+	if (accumulate.partials != NULL) {
+		parallelJobsRun(&accumulateReduceJob, &accumulate, accumulate.chunksNumber, accumulate.chunksNumber);
+
+		free(accumulate.partials);
+	}
+
+	return (accumulated);
 }
@@ -0,0 +1,77 @@
+#ifndef LIBCAER_SRC_PARALLEL_JOBS_H_
+#define LIBCAER_SRC_PARALLEL_JOBS_H_
+
+#include "libcaer/libcaer.h"
+
+#if defined(HAVE_PTHREADS)
+#	include "c11threads_posix.h"
+#endif
+
+// Split work into independent jobs (bands of rows, tiles, chunks of events)
+// and run them on short-lived threads, for the frame utils and the accumulator.
+#define PARALLEL_JOBS_MAX_THREADS 16
+
+typedef void (*parallelJob)(void *data, size_t jobIndex);
+
+struct parallel_jobs {
+	parallelJob job;
+	void *data;
+	size_t jobsNumber;
+	size_t firstJob;
+	size_t jobsStep;
+};
+
+static int parallelJobsThread(void *parallelPtr) {
+	const struct parallel_jobs *parallel = parallelPtr;
+
+	for (size_t i = parallel->firstJob; i < parallel->jobsNumber; i += parallel->jobsStep) {
+		(*parallel->job)(parallel->data, i);
+	}
+
+	return (0);
+}
+
+static void parallelJobsRun(parallelJob job, void *data, size_t jobsNumber, size_t threadsNumber) {
+	if ((jobsNumber == 0) || (threadsNumber == 0)) {
+		return;
+	}
+
+	if (threadsNumber > jobsNumber) {
+		threadsNumber = jobsNumber;
+	}
+
+	if (threadsNumber > PARALLEL_JOBS_MAX_THREADS) {
+		threadsNumber = PARALLEL_JOBS_MAX_THREADS;
+	}
+
+	struct parallel_jobs parallel[PARALLEL_JOBS_MAX_THREADS];
+	thrd_t threads[PARALLEL_JOBS_MAX_THREADS];
+	bool threadsStarted[PARALLEL_JOBS_MAX_THREADS] = {false};
+
+	for (size_t t = 0; t < threadsNumber; t++) {
+		parallel[t].job        = job;
+		parallel[t].data       = data;
+		parallel[t].jobsNumber = jobsNumber;
+		parallel[t].firstJob   = t;
+		parallel[t].jobsStep   = threadsNumber;
+	}
+
+	// The calling thread does the first share of jobs. If a thread
+	// cannot be started, its share is done by the calling thread too.
+	for (size_t t = 1; t < threadsNumber; t++) {
+		threadsStarted[t] = (thrd_create(&threads[t], &parallelJobsThread, &parallel[t]) == thrd_success);
+	}
+
+	parallelJobsThread(&parallel[0]);
+
+	for (size_t t = 1; t < threadsNumber; t++) {
+		if (threadsStarted[t]) {
+			thrd_join(threads[t], NULL);
+		}
+		else {
+			parallelJobsThread(&parallel[t]);
+		}
+	}
+}
+
+#endif /* LIBCAER_SRC_PARALLEL_JOBS_H_ */
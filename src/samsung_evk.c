@@ -4,6 +4,9 @@ static void samsungEVKLog(enum caer_log_level logLevel, samsungEVKHandle handle,
 	ATTRIBUTE_FORMAT(3);
 static void samsungEVKEventTranslator(void *vhd, const uint8_t *buffer, const size_t bytesSent);
 static void resetParser(samsungEVKHandle handle, const char *reason);
+static inline void groupDecode(
+	samsungEVKState state, uint8_t groupEvents, bool groupPolarity, int32_t groupAddress, uint16_t columnAddress);
+static void columnSort(samsungEVKHandle handle);
 
 static bool i2cConfigSend(usbState state, uint16_t deviceAddr, uint16_t byteAddr, uint8_t param);
 static bool i2cConfigReceive(usbState state, uint16_t deviceAddr, uint16_t byteAddr, uint8_t *param);
@@ -34,8 +37,8 @@ static void populateDeviceInfo(
 
 	// Fixed information.
 	evkInfoPtr->chipID   = SAMSUNG_EVK_CHIP_ID;
-	evkInfoPtr->dvsSizeX = 640;
-	evkInfoPtr->dvsSizeY = 480;
+	evkInfoPtr->dvsSizeX = SAMSUNG_EVK_DVS_SIZE_X;
+	evkInfoPtr->dvsSizeY = SAMSUNG_EVK_DVS_SIZE_Y;
 
 	if (devHandle != NULL) {
 		// Populate info variables based on data from device.
@@ -78,6 +81,10 @@ static inline void freeAllDataMemory(samsungEVKState state) {
 	}
 
 	containerGenerationDestroy(&state->container);
+
+	free(state->dvs.sortBuffer);
+	state->dvs.sortBuffer     = NULL;
+	state->dvs.sortBufferSize = 0;
 }
 
 caerDeviceHandle samsungEVKOpen(
@@ -419,6 +426,18 @@ bool samsungEVKConfigSet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 			}
 			break;
 
+		case CAER_HOST_CONFIG_POLARITY_PACKETS:
+			switch (paramAddr) {
+				case CAER_HOST_CONFIG_POLARITY_PACKETS_SORT_COLUMNS:
+					atomic_store(&state->dvs.sortColumns, param);
+					break;
+
+				default:
+					return (false);
+					break;
+			}
+			break;
+
 		case SAMSUNG_EVK_DVS:
 			switch (paramAddr) {
 				case SAMSUNG_EVK_DVS_MODE: {
@@ -1130,6 +1149,18 @@ bool samsungEVKConfigGet(caerDeviceHandle cdh, int8_t modAddr, uint8_t paramAddr
 			}
 			break;
 
+		case CAER_HOST_CONFIG_POLARITY_PACKETS:
+			switch (paramAddr) {
+				case CAER_HOST_CONFIG_POLARITY_PACKETS_SORT_COLUMNS:
+					*param = atomic_load(&state->dvs.sortColumns);
+					break;
+
+				default:
+					return (false);
+					break;
+			}
+			break;
+
 		case SAMSUNG_EVK_DVS:
 			switch (paramAddr) {
 				case SAMSUNG_EVK_DVS_MODE: {
@@ -1906,6 +1937,7 @@ bool samsungEVKDataStop(caerDeviceHandle cdh) {
 	// Reset packet positions.
 	state->currentPackets.polarityPosition = 0;
 	state->currentPackets.specialPosition  = 0;
+	state->dvs.columnStart                 = 0;
 
 	return (true);
 }
@@ -1947,6 +1979,160 @@ static void resetParser(samsungEVKHandle handle, const char *reason) {
 	samsungEVKLog(CAER_LOG_INFO, handle, "Parser reset, reason: %s.", reason);
 }
 
+// Group decode tables, built at compile time: number of set pixels in each
+// possible group mask, and their Y offsets inside the group, in ascending
+// order. GROUP_OFFSET(m, k) is the position of the k-th set bit of m.
+#define GROUP_BIT(m, i) (((m) >> (i)) & 0x01)
+#define GROUP_COUNT(m)                                                                                         \
+	(GROUP_BIT(m, 0) + GROUP_BIT(m, 1) + GROUP_BIT(m, 2) + GROUP_BIT(m, 3) + GROUP_BIT(m, 4) + GROUP_BIT(m, 5) \
+		+ GROUP_BIT(m, 6) + GROUP_BIT(m, 7))
+#define GROUP_OFFSET_AT(m, k, i) \
+	(((GROUP_BIT(m, i) != 0) && (GROUP_COUNT((m) & ((1 << (i)) - 1)) == (k))) ? (i) : (0))
+#define GROUP_OFFSET(m, k)                                                                                           \
+	(GROUP_OFFSET_AT(m, k, 0) + GROUP_OFFSET_AT(m, k, 1) + GROUP_OFFSET_AT(m, k, 2) + GROUP_OFFSET_AT(m, k, 3)       \
+		+ GROUP_OFFSET_AT(m, k, 4) + GROUP_OFFSET_AT(m, k, 5) + GROUP_OFFSET_AT(m, k, 6) + GROUP_OFFSET_AT(m, k, 7))
+#define GROUP_OFFSETS(m)                                                                                 \
+	{GROUP_OFFSET(m, 0), GROUP_OFFSET(m, 1), GROUP_OFFSET(m, 2), GROUP_OFFSET(m, 3), GROUP_OFFSET(m, 4), \
+		GROUP_OFFSET(m, 5), GROUP_OFFSET(m, 6), GROUP_OFFSET(m, 7)}
+
+#define GROUP_TABLE_4(ENTRY, m) ENTRY(m), ENTRY((m) + 1), ENTRY((m) + 2), ENTRY((m) + 3)
+#define GROUP_TABLE_16(ENTRY, m)                                                           \
+	GROUP_TABLE_4(ENTRY, m), GROUP_TABLE_4(ENTRY, (m) + 4), GROUP_TABLE_4(ENTRY, (m) + 8), \
+		GROUP_TABLE_4(ENTRY, (m) + 12)
+#define GROUP_TABLE_64(ENTRY, m)                                                                \
+	GROUP_TABLE_16(ENTRY, m), GROUP_TABLE_16(ENTRY, (m) + 16), GROUP_TABLE_16(ENTRY, (m) + 32), \
+		GROUP_TABLE_16(ENTRY, (m) + 48)
+#define GROUP_TABLE_256(ENTRY) \
+	GROUP_TABLE_64(ENTRY, 0), GROUP_TABLE_64(ENTRY, 64), GROUP_TABLE_64(ENTRY, 128), GROUP_TABLE_64(ENTRY, 192)
+
+static const uint8_t groupPixelsNumber[SAMSUNG_EVK_GROUP_MASKS] = {GROUP_TABLE_256(GROUP_COUNT)};
+static const uint8_t groupPixelsOffset[SAMSUNG_EVK_GROUP_MASKS][SAMSUNG_EVK_GROUP_PIXELS]
+	= {GROUP_TABLE_256(GROUP_OFFSETS)};
+
+// Append the events of one 8-pixel group directly to the polarity packet.
+// Space for them must already be available. All events share timestamp,
+// polarity and X address, so only the Y address changes between them.
+static inline void groupDecode(
+	samsungEVKState state, uint8_t groupEvents, bool groupPolarity, int32_t groupAddress, uint16_t columnAddress) {
+	int32_t number         = groupPixelsNumber[groupEvents];
+	const uint8_t *offsets = groupPixelsOffset[groupEvents];
+
+	uint32_t baseData = (U32T(1) << VALID_MARK_SHIFT) | (U32T(groupPolarity) << POLARITY_SHIFT)
+						| (U32T(columnAddress) << POLARITY_X_ADDR_SHIFT)
+						| (U32T(groupAddress) << POLARITY_Y_ADDR_SHIFT);
+	int32_t timestamp = I32T(htole32(U32T(state->timestamps.current)));
+
+	caerPolarityEvent events
+		= caerPolarityEventPacketGetEvent(state->currentPackets.polarity, state->currentPackets.polarityPosition);
+
+	for (int32_t i = 0; i < number; i++) {
+		events[i].data      = htole32(baseData + (U32T(offsets[i]) << POLARITY_Y_ADDR_SHIFT));
+		events[i].timestamp = timestamp;
+	}
+
+	state->currentPackets.polarityPosition += number;
+}
+
+// Stable counting sort by Y address of the events of the current column,
+// which all share timestamp and X address. Runs already in order are left as-is.
+static void columnSort(samsungEVKHandle handle) {
+	samsungEVKState state = &handle->state;
+
+	int32_t start = state->dvs.columnStart;
+	size_t number = (size_t) (state->currentPackets.polarityPosition - start);
+
+	if (number < 2) {
+		return;
+	}
+
+	caerPolarityEvent events = caerPolarityEventPacketGetEvent(state->currentPackets.polarity, start);
+
+	uint16_t minY  = caerPolarityEventGetY(&events[0]);
+	uint16_t maxY  = minY;
+	uint16_t lastY = minY;
+	bool inOrder   = true;
+
+	for (size_t i = 1; i < number; i++) {
+		uint16_t y = caerPolarityEventGetY(&events[i]);
+
+		inOrder = inOrder && (y >= lastY);
+		minY    = (y < minY) ? (y) : (minY);
+		maxY    = (y > maxY) ? (y) : (maxY);
+		lastY   = y;
+	}
+
+	if (inOrder) {
+		return;
+	}
+
+	if (number > state->dvs.sortBufferSize) {
+		struct caer_polarity_event *newBuffer
+			= realloc(state->dvs.sortBuffer, number * sizeof(struct caer_polarity_event));
+		if (newBuffer == NULL) {
+			samsungEVKLog(CAER_LOG_ERROR, handle, "Failed to allocate memory for column sorting.");
+			return;
+		}
+
+		state->dvs.sortBuffer     = newBuffer;
+		state->dvs.sortBufferSize = number;
+	}
+
+	// Count events per row, only over the rows actually present.
+	int32_t *counts = state->dvs.sortCounts;
+	memset(&counts[minY], 0, (size_t) (maxY - minY + 1) * sizeof(int32_t));
+
+	for (size_t i = 0; i < number; i++) {
+		counts[caerPolarityEventGetY(&events[i])]++;
+	}
+
+	// Turn counts into output positions.
+	int32_t position = 0;
+
+	for (size_t y = minY; y <= maxY; y++) {
+		int32_t rowCount = counts[y];
+
+		counts[y] = position;
+		position += rowCount;
+	}
+
+	for (size_t i = 0; i < number; i++) {
+		state->dvs.sortBuffer[counts[caerPolarityEventGetY(&events[i])]++] = events[i];
+	}
+
+	memcpy(events, state->dvs.sortBuffer, number * sizeof(struct caer_polarity_event));
+}
+
+// Packets only go away on commit, so checking for them once per buffer and
+// after each commit is enough to keep them valid for the whole event loop.
+static bool samsungEVKEnsurePackets(samsungEVKHandle handle) {
+	samsungEVKState state = &handle->state;
+
+	if (!containerGenerationAllocate(&state->container, SAMSUNG_EVK_EVENT_TYPES)) {
+		samsungEVKLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
+		return (false);
+	}
+
+	if (state->currentPackets.special == NULL) {
+		state->currentPackets.special = caerSpecialEventPacketAllocate(
+			SAMSUNG_EVK_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+		if (state->currentPackets.special == NULL) {
+			samsungEVKLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
+			return (false);
+		}
+	}
+
+	if (state->currentPackets.polarity == NULL) {
+		state->currentPackets.polarity = caerPolarityEventPacketAllocate(
+			SAMSUNG_EVK_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
+		if (state->currentPackets.polarity == NULL) {
+			samsungEVKLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
+			return (false);
+		}
+	}
+
+	return (true);
+}
+
 static void samsungEVKEventTranslator(void *vhd, const uint8_t *buffer, const size_t bufferSize) {
 	samsungEVKHandle handle = vhd;
 	samsungEVKState state   = &handle->state;
@@ -1966,31 +2152,13 @@ static void samsungEVKEventTranslator(void *vhd, const uint8_t *buffer, const si
 		return;
 	}
 
-	for (size_t bufferPos = 0; bufferPos < bufferSize; bufferPos += 4) {
-		// Allocate new packets for next iteration as needed.
-		if (!containerGenerationAllocate(&state->container, SAMSUNG_EVK_EVENT_TYPES)) {
-			samsungEVKLog(CAER_LOG_CRITICAL, handle, "Failed to allocate event packet container.");
-			return;
-		}
-
-		if (state->currentPackets.special == NULL) {
-			state->currentPackets.special = caerSpecialEventPacketAllocate(
-				SAMSUNG_EVK_SPECIAL_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.special == NULL) {
-				samsungEVKLog(CAER_LOG_CRITICAL, handle, "Failed to allocate special event packet.");
-				return;
-			}
-		}
+	bool sortColumns = atomic_load_explicit(&state->dvs.sortColumns, memory_order_relaxed);
 
-		if (state->currentPackets.polarity == NULL) {
-			state->currentPackets.polarity = caerPolarityEventPacketAllocate(
-				SAMSUNG_EVK_POLARITY_DEFAULT_SIZE, I16T(handle->info.deviceID), state->timestamps.wrapOverflow);
-			if (state->currentPackets.polarity == NULL) {
-				samsungEVKLog(CAER_LOG_CRITICAL, handle, "Failed to allocate polarity event packet.");
-				return;
-			}
-		}
+	if (!samsungEVKEnsurePackets(handle)) {
+		return;
+	}
 
+	for (size_t bufferPos = 0; bufferPos < bufferSize; bufferPos += 4) {
 		bool tsReset   = false;
 		bool tsBigWrap = false;
 
@@ -2036,51 +2204,34 @@ static void samsungEVKEventTranslator(void *vhd, const uint8_t *buffer, const si
 
 			uint8_t group1Events = (event >> 0) & 0x00FF;
 			bool group1Polarity  = (((event >> 16) & 0x01) == 0); // ON polarity is 0 here.
-
-			for (uint8_t i = 0, mask = 0x01; i < 8; i++, mask = U8T(mask << 1)) {
-				// Check if event present first.
-				if ((group1Events & mask) == 0) {
-					continue;
-				}
-
-				// Received event!
-				caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-					state->currentPackets.polarity, state->currentPackets.polarityPosition);
-
-				// Timestamp at event-stream insertion point.
-				caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-				caerPolarityEventSetPolarity(currentPolarityEvent, group1Polarity);
-				caerPolarityEventSetX(currentPolarityEvent, U16T(state->dvs.lastColumn));
-				caerPolarityEventSetY(currentPolarityEvent, U16T(group1Address + i));
-				caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
-				state->currentPackets.polarityPosition++;
-			}
-
 			uint8_t group2Events = (event >> 8) & 0x00FF;
 			bool group2Polarity  = (((event >> 17) & 0x01) == 0); // ON polarity is 0 here.
 
-			for (uint8_t i = 0, mask = 0x01; i < 8; i++, mask = U8T(mask << 1)) {
-				// Check if event present first.
-				if ((group2Events & mask) == 0) {
-					continue;
-				}
+			// Expand set pixels via lookup tables, timestamp at event-stream insertion point.
+			int32_t previousPosition = state->currentPackets.polarityPosition;
 
-				// Received event!
-				caerPolarityEvent currentPolarityEvent = caerPolarityEventPacketGetEvent(
-					state->currentPackets.polarity, state->currentPackets.polarityPosition);
+			groupDecode(state, group1Events, group1Polarity, group1Address, U16T(state->dvs.lastColumn));
+			groupDecode(state, group2Events, group2Polarity, group2Address, U16T(state->dvs.lastColumn));
 
-				// Timestamp at event-stream insertion point.
-				caerPolarityEventSetTimestamp(currentPolarityEvent, state->timestamps.current);
-				caerPolarityEventSetPolarity(currentPolarityEvent, group2Polarity);
-				caerPolarityEventSetX(currentPolarityEvent, U16T(state->dvs.lastColumn));
-				caerPolarityEventSetY(currentPolarityEvent, U16T(group2Address + i));
-				caerPolarityEventValidate(currentPolarityEvent, state->currentPackets.polarity);
-				state->currentPackets.polarityPosition++;
-			}
+			// All new events are valid, update packet header counters once.
+			int32_t newEvents = state->currentPackets.polarityPosition - previousPosition;
+
+			caerEventPacketHeader polarityHeader = &state->currentPackets.polarity->packetHeader;
+			caerEventPacketHeaderSetEventNumber(
+				polarityHeader, caerEventPacketHeaderGetEventNumber(polarityHeader) + newEvents);
+			caerEventPacketHeaderSetEventValid(
+				polarityHeader, caerEventPacketHeaderGetEventValid(polarityHeader) + newEvents);
 		}
 		else {
 			// COLUMN event.
 			if ((event & 0x04000000U) != 0) {
+				// Any column event ends the events of the previous column.
+				if (sortColumns) {
+					columnSort(handle);
+				}
+
+				state->dvs.columnStart = state->currentPackets.polarityPosition;
+
 				if (state->timestamps.reference < 0) {
 					// Wait until first timestamp reference in (every 1ms),
 					// so that time-relative fields have been initialized properly.
@@ -2202,11 +2353,17 @@ static void samsungEVKEventTranslator(void *vhd, const uint8_t *buffer, const si
 			bool emptyContainerCommit = true;
 
 			if (state->currentPackets.polarityPosition > 0) {
+				// The current column continues in the next packet.
+				if (sortColumns) {
+					columnSort(handle);
+				}
+
 				containerGenerationSetPacket(
 					&state->container, POLARITY_EVENT, (caerEventPacketHeader) state->currentPackets.polarity);
 
 				state->currentPackets.polarity         = NULL;
 				state->currentPackets.polarityPosition = 0;
+				state->dvs.columnStart                 = 0;
 				emptyContainerCommit                   = false;
 			}
 
@@ -2222,6 +2379,11 @@ static void samsungEVKEventTranslator(void *vhd, const uint8_t *buffer, const si
 			containerGenerationExecute(&state->container, emptyContainerCommit, tsReset, state->timestamps.wrapOverflow,
 				state->timestamps.current, &state->dataExchange, &state->usbState.dataTransfersRun,
 				handle->info.deviceID, handle->info.deviceString, &state->deviceLogLevel);
+
+			// Committed packets are gone, get new ones for the rest of the buffer.
+			if (!samsungEVKEnsurePackets(handle)) {
+				return;
+			}
 		}
 	}
 }
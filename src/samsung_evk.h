@@ -13,6 +13,13 @@
 #define SAMSUNG_EVK_POLARITY_DEFAULT_SIZE 8192
 #define SAMSUNG_EVK_SPECIAL_DEFAULT_SIZE  128
 
+// SGROUP/MGROUP events carry two groups of 8 pixels each, as bit masks.
+#define SAMSUNG_EVK_GROUP_PIXELS 8
+#define SAMSUNG_EVK_GROUP_MASKS  256
+
+#define SAMSUNG_EVK_DVS_SIZE_X 640
+#define SAMSUNG_EVK_DVS_SIZE_Y 480
+
 #define SAMSUNG_EVK_DEVICE_NAME "Samsung EVK"
 
 #define SAMSUNG_EVK_DEVICE_VID 0x04B4
@@ -129,6 +136,13 @@ struct samsung_evk_state {
 		int16_t lastColumn;
 		uint16_t cropperYStart;
 		uint16_t cropperYEnd;
+		// Column sorting: enable flag, start of the current column's events
+		// in the polarity packet, and counting sort memory.
+		atomic_bool sortColumns;
+		int32_t columnStart;
+		int32_t sortCounts[SAMSUNG_EVK_DVS_SIZE_Y];
+		struct caer_polarity_event *sortBuffer;
+		size_t sortBufferSize;
 	} dvs;
 	// Packet Container state
 	struct container_generation container;
@@ -0,0 +1,331 @@
+// Check the DVS132S event translator, including its bulk decoding of
+// DVS address event runs (dvsDecodeRun), against a straightforward
+// per-word reference decoder of the same USB data format.
+// The translator is static, so the driver source is included directly.
+// Synthetic USB buffers are used, fed to the translator in chunks of
+// different sizes and with different packet commit sizes, so that event
+// runs are cut at buffer ends and at packet commits in all possible ways.
+#include "../src/dvs132s.c"
+
+#include <stdio.h>
+
+#define TEST_SIZE_X         132
+#define TEST_SIZE_Y         104
+#define TEST_BUFFER_EVENTS  (128 * 1024)
+#define TEST_EXCHANGE_SIZE  4096
+#define TEST_GENERATOR_SEED 42
+
+struct reference_decoder {
+	struct timestamps_state_new_logic timestamps;
+	atomic_uint_fast8_t logLevel;
+	bool invertXY;
+	uint16_t lastX;
+	uint16_t lastY;
+	struct caer_polarity_event *events;
+	size_t eventsNumber;
+};
+
+struct translated_events {
+	struct caer_polarity_event *events;
+	size_t eventsNumber;
+	size_t eventsCapacity;
+	size_t packetsTooBig;
+};
+
+static char deviceString[] = "DVS132S test";
+
+static uint32_t generatorState = TEST_GENERATOR_SEED;
+
+static uint32_t generatorNext(uint32_t range) {
+	// xorshift32, enough for test data and identical on all platforms.
+	generatorState ^= generatorState << 13;
+	generatorState ^= generatorState >> 17;
+	generatorState ^= generatorState << 5;
+
+	return (generatorState % range);
+}
+
+// Mostly DVS address events, with timestamps, wraps, external input events
+// and the occasional out-of-range address mixed in. No timestamp resets,
+// as they also query the device.
+static size_t generateBuffer(uint8_t *buffer, size_t eventsNumber) {
+	uint16_t timestamp = 0;
+
+	for (size_t i = 0; i < eventsNumber; i++) {
+		uint32_t type = generatorNext(1000);
+		uint16_t event;
+
+		if (type < 40) {
+			timestamp = U16T((timestamp + 1 + generatorNext(50)) & 0x7FFF);
+			event     = U16T(0x8000 | timestamp);
+		}
+		else if (type < 42) {
+			timestamp = 0;
+			event     = U16T(0x7000 | 1); // Wrap, time continues from zero.
+		}
+		else if (type < 45) {
+			event = U16T(0x0000 | (2 + generatorNext(3))); // External input.
+		}
+		else if (type < 150) {
+			event = U16T(0x1000 | generatorNext(TEST_SIZE_Y + 4));
+		}
+		else if (type < 300) {
+			event = U16T(0x2000 | generatorNext(TEST_SIZE_X + 4));
+		}
+		else {
+			event = U16T(0x3000 | generatorNext(256));
+		}
+
+		buffer[(i * 2)]     = U8T(event & 0xFF);
+		buffer[(i * 2) + 1] = U8T(event >> 8);
+	}
+
+	return (eventsNumber * 2);
+}
+
+static void referencePixel(struct reference_decoder *ref, uint16_t x, uint16_t y, bool polarity) {
+	caerPolarityEvent event = &ref->events[ref->eventsNumber++];
+
+	memset(event, 0, sizeof(*event));
+
+	caerPolarityEventSetTimestamp(event, ref->timestamps.current);
+	caerPolarityEventSetPolarity(event, polarity);
+
+	if (ref->invertXY) {
+		caerPolarityEventSetX(event, y);
+		caerPolarityEventSetY(event, x);
+	}
+	else {
+		caerPolarityEventSetX(event, x);
+		caerPolarityEventSetY(event, y);
+	}
+
+	// Same as caerPolarityEventValidate(), without a packet to count in.
+	SET_NUMBITS32(event->data, VALID_MARK_SHIFT, VALID_MARK_MASK, 1);
+}
+
+// One USB word at a time, each present pixel of a group on its own.
+static void referenceDecode(struct reference_decoder *ref, const uint8_t *buffer, size_t bufferSize) {
+	for (size_t bufferPos = 0; bufferPos < bufferSize; bufferPos += 2) {
+		uint16_t event = le16toh(*((const uint16_t *) (&buffer[bufferPos])));
+		uint16_t data  = (event & 0x0FFF);
+
+		if ((event & 0x8000) != 0) {
+			handleTimestampUpdateNewLogic(&ref->timestamps, event, "reference", &ref->logLevel);
+			continue;
+		}
+
+		switch ((event & 0x7000) >> 12) {
+			case 1:
+				if (data < TEST_SIZE_Y) {
+					ref->lastY = data;
+				}
+				break;
+
+			case 2:
+				if (data < TEST_SIZE_X) {
+					ref->lastX = data;
+				}
+				break;
+
+			case 3:
+				if (data & 0x0010) {
+					referencePixel(ref, ref->lastX, ref->lastY, data & 0x0001);
+				}
+				if (data & 0x0020) {
+					referencePixel(ref, U16T(ref->lastX + 1), ref->lastY, data & 0x0002);
+				}
+				if (data & 0x0040) {
+					referencePixel(ref, ref->lastX, U16T(ref->lastY + 1), data & 0x0004);
+				}
+				if (data & 0x0080) {
+					referencePixel(ref, U16T(ref->lastX + 1), U16T(ref->lastY + 1), data & 0x0008);
+				}
+				break;
+
+			case 7:
+				handleTimestampWrapNewLogic(&ref->timestamps, data, TS_WRAP_ADD, "reference", &ref->logLevel);
+				break;
+
+			default:
+				break;
+		}
+	}
+}
+
+static bool collectContainers(dvs132sHandle handle, struct translated_events *out, int32_t commitSize) {
+	caerEventPacketContainer container;
+
+	while ((container = dvs132sDataGet((caerDeviceHandle) handle)) != NULL) {
+		caerPolarityEventPacketConst polarity
+			= (caerPolarityEventPacketConst) caerEventPacketContainerGetEventPacketConst(container, POLARITY_EVENT);
+
+		if (polarity != NULL) {
+			size_t number = (size_t) caerEventPacketHeaderGetEventNumber(&polarity->packetHeader);
+
+			if (caerEventPacketHeaderGetEventValid(&polarity->packetHeader) != I32T(number)) {
+				caerEventPacketContainerFree(container);
+				return (false);
+			}
+
+			// A group can add up to 4 events after the commit size was reached.
+			if ((commitSize > 0) && (number >= (size_t) (commitSize + 4))) {
+				out->packetsTooBig++;
+			}
+
+			if ((out->eventsNumber + number) > out->eventsCapacity) {
+				caerEventPacketContainerFree(container);
+				return (false);
+			}
+
+			memcpy(&out->events[out->eventsNumber], polarity->events, number * sizeof(struct caer_polarity_event));
+			out->eventsNumber += number;
+		}
+
+		caerEventPacketContainerFree(container);
+	}
+
+	return (true);
+}
+
+static bool translatorRun(const uint8_t *buffer, size_t bufferSize, size_t chunkSize, int32_t commitSize,
+	bool invertXY, struct translated_events *out) {
+	struct dvs132s_handle *handle = calloc(1, sizeof(struct dvs132s_handle));
+	if (handle == NULL) {
+		return (false);
+	}
+
+	dvs132sState state = &handle->state;
+
+	handle->deviceType        = CAER_DEVICE_DVS132S;
+	handle->info.deviceID     = 1;
+	handle->info.deviceString = deviceString;
+
+	atomic_store(&state->deviceLogLevel, CAER_LOG_EMERGENCY);
+
+	dataExchangeSettingsInit(&state->dataExchange);
+	dataExchangeConfigSet(&state->dataExchange, CAER_HOST_CONFIG_DATAEXCHANGE_BUFFER_SIZE, TEST_EXCHANGE_SIZE);
+
+	containerGenerationSettingsInit(&state->container);
+	containerGenerationConfigSet(
+		&state->container, CAER_HOST_CONFIG_PACKETS_MAX_CONTAINER_PACKET_SIZE, U32T(commitSize));
+	containerGenerationCommitTimestampReset(&state->container);
+
+	state->dvs.sizeX    = TEST_SIZE_X;
+	state->dvs.sizeY    = TEST_SIZE_Y;
+	state->dvs.invertXY = invertXY;
+
+	// Same setup as dvs132sDataStart(), without the device.
+	bool success = dataExchangeBufferInit(&state->dataExchange)
+				   && containerGenerationAllocate(&state->container, DVS132S_EVENT_TYPES);
+
+	if (success) {
+		state->currentPackets.polarity = caerPolarityEventPacketAllocate(DVS132S_POLARITY_DEFAULT_SIZE, 1, 0);
+		state->currentPackets.special  = caerSpecialEventPacketAllocate(DVS132S_SPECIAL_DEFAULT_SIZE, 1, 0);
+		state->currentPackets.imu6     = caerIMU6EventPacketAllocate(DVS132S_IMU_DEFAULT_SIZE, 1, 0);
+
+		success = (state->currentPackets.polarity != NULL) && (state->currentPackets.special != NULL)
+				  && (state->currentPackets.imu6 != NULL);
+	}
+
+	atomic_store(&state->usbState.dataTransfersRun, TRANS_RUNNING);
+
+	for (size_t pos = 0; success && (pos < bufferSize); pos += chunkSize) {
+		size_t size = ((bufferSize - pos) < chunkSize) ? (bufferSize - pos) : (chunkSize);
+
+		dvs132sEventTranslator(handle, &buffer[pos], size);
+
+		success = collectContainers(handle, out, commitSize);
+	}
+
+	// Events not yet committed are still in the current packet.
+	if (success && (state->currentPackets.polarity != NULL)) {
+		size_t number = (size_t) state->currentPackets.polarityPosition;
+
+		if ((out->eventsNumber + number) > out->eventsCapacity) {
+			success = false;
+		}
+		else {
+			memcpy(&out->events[out->eventsNumber], state->currentPackets.polarity->events,
+				number * sizeof(struct caer_polarity_event));
+			out->eventsNumber += number;
+		}
+	}
+
+	freeAllDataMemory(state);
+	free(handle);
+
+	return (success);
+}
+
+int main(void) {
+	const size_t chunkSizes[] = {2, 6, 512, 16 * 1024, 2 * TEST_BUFFER_EVENTS};
+	const int32_t commitSizes[] = {0, 1, 3, 7, 100, 4096};
+
+	size_t bufferSize = 2 * TEST_BUFFER_EVENTS;
+	uint8_t *buffer   = malloc(bufferSize);
+
+	// Every group has at most 4 pixels.
+	size_t maxEvents                = 4 * TEST_BUFFER_EVENTS;
+	struct reference_decoder ref    = {.events = calloc(maxEvents, sizeof(struct caer_polarity_event))};
+	struct translated_events result = {
+		.events = calloc(maxEvents, sizeof(struct caer_polarity_event)), .eventsCapacity = maxEvents};
+
+	if ((buffer == NULL) || (ref.events == NULL) || (result.events == NULL)) {
+		fprintf(stderr, "Failed to allocate test memory.\n");
+		return (EXIT_FAILURE);
+	}
+
+	generateBuffer(buffer, TEST_BUFFER_EVENTS);
+
+	atomic_store(&ref.logLevel, CAER_LOG_EMERGENCY);
+
+	size_t runs     = 0;
+	size_t failures = 0;
+
+	for (size_t inv = 0; inv < 2; inv++) {
+		memset(&ref.timestamps, 0, sizeof(ref.timestamps));
+		ref.invertXY     = (inv != 0);
+		ref.lastX        = 0;
+		ref.lastY        = 0;
+		ref.eventsNumber = 0;
+
+		referenceDecode(&ref, buffer, bufferSize);
+
+		for (size_t c = 0; c < (sizeof(chunkSizes) / sizeof(chunkSizes[0])); c++) {
+			for (size_t s = 0; s < (sizeof(commitSizes) / sizeof(commitSizes[0])); s++) {
+				// Containers are only collected between chunks: skip combinations
+				// that would commit more of them at once than the exchange holds.
+				if ((commitSizes[s] > 0) && ((chunkSizes[c] / (size_t) commitSizes[s]) > 1024)) {
+					continue;
+				}
+
+				result.eventsNumber  = 0;
+				result.packetsTooBig = 0;
+				runs++;
+
+				bool success = translatorRun(buffer, bufferSize, chunkSizes[c], commitSizes[s], ref.invertXY, &result);
+
+				if (success && (result.eventsNumber == ref.eventsNumber) && (result.packetsTooBig == 0)
+					&& (memcmp(result.events, ref.events, ref.eventsNumber * sizeof(struct caer_polarity_event))
+						== 0)) {
+					continue;
+				}
+
+				failures++;
+				fprintf(stderr,
+					"Mismatch: invertXY=%zu, chunk size=%zu, commit size=%" PRIi32
+					": %zu events translated, %zu expected, %zu packets too big.\n",
+					inv, chunkSizes[c], commitSizes[s], result.eventsNumber, ref.eventsNumber, result.packetsTooBig);
+			}
+		}
+	}
+
+	printf("DVS132S translator: %zu of %zu runs match the reference decoder.\n", runs - failures, runs);
+
+	free(buffer);
+	free(ref.events);
+	free(result.events);
+
+	return ((failures == 0) ? (EXIT_SUCCESS) : (EXIT_FAILURE));
+}
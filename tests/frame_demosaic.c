@@ -0,0 +1,137 @@
+// Check demosaicing, to 16bit frames and with contrast to 8bit pixels, on
+// all color filters and on frame sizes down to a single row or column,
+// where border pixels can lack neighbors of the needed color entirely.
+// Every demosaiced value must lie within the input range, and the 8bit
+// output must be the 16bit output mapped through the contrast range.
+#include <libcaer/frame_utils.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#define TEST_GENERATOR_SEED 42
+
+static uint32_t generatorState = TEST_GENERATOR_SEED;
+
+static uint16_t generatorNext(void) {
+	// xorshift32, enough for test data and identical on all platforms.
+	generatorState ^= generatorState << 13;
+	generatorState ^= generatorState >> 17;
+	generatorState ^= generatorState << 5;
+
+	return ((uint16_t) (generatorState >> 16));
+}
+
+static caerFrameEventPacket frameAllocate(
+	int32_t lengthX, int32_t lengthY, enum caer_frame_event_color_channels channels) {
+	caerFrameEventPacket packet = caerFrameEventPacketAllocate(1, 0, 0, lengthX, lengthY, channels);
+	if (packet == NULL) {
+		return (NULL);
+	}
+
+	caerFrameEvent frame = caerFrameEventPacketGetEvent(packet, 0);
+	caerFrameEventSetLengthXLengthYChannelNumber(frame, lengthX, lengthY, channels, packet);
+
+	return (packet);
+}
+
+static bool checkFrame(int32_t lengthX, int32_t lengthY, enum caer_frame_event_color_filter colorFilter,
+	int32_t position, enum caer_frame_utils_demosaic_types demosaicType) {
+	enum caer_frame_event_color_channels channels = (demosaicType == DEMOSAIC_STANDARD) ? (RGB) : (GRAYSCALE);
+	size_t pixelsNumber                           = (size_t) lengthX * (size_t) lengthY;
+
+	caerFrameEventPacket input  = frameAllocate(lengthX, lengthY, GRAYSCALE);
+	caerFrameEventPacket output = frameAllocate(lengthX, lengthY, channels);
+	uint8_t *output8Bit         = malloc(pixelsNumber * channels);
+
+	if ((input == NULL) || (output == NULL) || (output8Bit == NULL)) {
+		fprintf(stderr, "Failed to allocate test memory.\n");
+		free(input);
+		free(output);
+		free(output8Bit);
+		return (false);
+	}
+
+	caerFrameEvent inputFrame = caerFrameEventPacketGetEvent(input, 0);
+	caerFrameEventSetColorFilter(inputFrame, colorFilter);
+	caerFrameEventSetPositionX(inputFrame, position & 0x01);
+	caerFrameEventSetPositionY(inputFrame, position >> 1);
+
+	uint16_t *inPixels = caerFrameEventGetPixelArrayUnsafe(inputFrame);
+	uint16_t minValue  = UINT16_MAX;
+	uint16_t maxValue  = 0;
+
+	for (size_t i = 0; i < pixelsNumber; i++) {
+		// Keep values away from zero, so a missing neighbor is not hidden.
+		inPixels[i] = (uint16_t) (1024 + (generatorNext() % 60000));
+
+		minValue = (inPixels[i] < minValue) ? (inPixels[i]) : (minValue);
+		maxValue = (inPixels[i] > maxValue) ? (inPixels[i]) : (maxValue);
+	}
+
+	caerFrameEvent outputFrame = caerFrameEventPacketGetEvent(output, 0);
+
+	caerFrameUtilsDemosaic(inputFrame, outputFrame, demosaicType);
+	caerFrameUtilsDemosaicContrast8Bit(inputFrame, output8Bit, demosaicType);
+
+	const uint16_t *outPixels = caerFrameEventGetPixelArrayUnsafe(outputFrame);
+	uint32_t range            = (uint32_t) (maxValue - minValue);
+	bool success              = true;
+
+	for (size_t i = 0; i < (pixelsNumber * channels); i++) {
+		uint16_t value = le16toh(outPixels[i]);
+
+		if ((value < minValue) || (value > maxValue)) {
+			fprintf(stderr, "%dx%d, filter %d, position %d, type %d: value %u at %zu outside of [%u, %u].\n",
+				lengthX, lengthY, colorFilter, position, demosaicType, value, i, minValue, maxValue);
+			success = false;
+			break;
+		}
+
+		uint8_t expected
+			= (range == 0) ? ((uint8_t) (minValue >> 8)) : ((uint8_t) (((value - minValue) * UINT8_MAX) / range));
+
+		if (output8Bit[i] != expected) {
+			fprintf(stderr, "%dx%d, filter %d, position %d, type %d: 8bit value %u at %zu, expected %u.\n", lengthX,
+				lengthY, colorFilter, position, demosaicType, output8Bit[i], i, expected);
+			success = false;
+			break;
+		}
+	}
+
+	free(input);
+	free(output);
+	free(output8Bit);
+
+	return (success);
+}
+
+int main(void) {
+	static const int32_t sizes[][2] = {{1, 1}, {1, 2}, {1, 8}, {2, 1}, {8, 1}, {2, 2}, {2, 7}, {7, 2}, {3, 3},
+		{5, 4}, {4, 5}, {9, 7}, {346, 260}};
+	static const enum caer_frame_event_color_filter colorFilters[]
+		= {RGBG, GRGB, GBGR, BGRG, RGBW, GRWB, WBGR, BWRG};
+
+	size_t runs     = 0;
+	size_t failures = 0;
+
+	for (size_t s = 0; s < (sizeof(sizes) / sizeof(sizes[0])); s++) {
+		for (size_t f = 0; f < (sizeof(colorFilters) / sizeof(colorFilters[0])); f++) {
+			for (int32_t position = 0; position < 4; position++) {
+				for (size_t t = 0; t < 2; t++) {
+					enum caer_frame_utils_demosaic_types demosaicType
+						= (t == 0) ? (DEMOSAIC_STANDARD) : (DEMOSAIC_TO_GRAY);
+
+					runs++;
+
+					if (!checkFrame(sizes[s][0], sizes[s][1], colorFilters[f], position, demosaicType)) {
+						failures++;
+					}
+				}
+			}
+		}
+	}
+
+	printf("Demosaic: %zu of %zu runs passed.\n", runs - failures, runs);
+
+	return ((failures == 0) ? (EXIT_SUCCESS) : (EXIT_FAILURE));
+}